@@ -12,6 +12,14 @@ ENHANCED VERSION WITH ALL REQUIRED ALGORITHMS AND DATA STRUCTURES
 #include <limits>
 #include <algorithm>
 #include <numeric>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+#if defined(__AVX2__) || defined(__AVX512BW__)
+#include <immintrin.h>
+#endif
 using namespace std;
 
 /**********************************************************************************************
@@ -35,7 +43,12 @@ const double FUEL_PRICE = 100.0;
 const double TRUCK_MILEAGE = 3.0;
 const int COLUMN_WIDTH = 35;
 const int MAX_HISTORY_SIZE = 100;
+const int SHIFT_START_HOUR = 6;              // shift clock: minute 0 = 06:00
+const int DRIVER_SHIFT_MINUTES = 480;        // driver shift cap (8 hours)
+const int MINUTES_PER_KM = 2;                // 30 km/h average truck speed
+const int DEFAULT_SERVICE_MINUTES = 10;      // time spent emptying one zone's bins
 string currentRole;
+string currentUser;
 bool loggedIn = false;
 
 /**********************************************************************************************
@@ -45,12 +58,18 @@ struct Zone {
     int id;
     string name;
     int currentWaste;
-    vector<int> history;
+    vector<int> history;           // one level per calendar day, oldest first
+    int historyDay;                // day number (WasteForecaster::today()) of the last entry
     double x, y;  // Coordinates for distance calculation
     int priority;
+    int windowOpen, windowClose;   // Access window in shift minutes (e.g. market hours)
+    int serviceTime;               // Minutes needed to collect at this zone
+    bool isDepot;                  // Dumping yard or transfer station (trucks unload here)
     
     Zone(int id = 0, string name = "", int currentWaste = 0, double x = 0.0, double y = 0.0)
-        : id(id), name(name), currentWaste(currentWaste), x(x), y(y), priority(0) {}
+        : id(id), name(name), currentWaste(currentWaste), historyDay(0), x(x), y(y), priority(0),
+          windowOpen(0), windowClose(DRIVER_SHIFT_MINUTES), serviceTime(DEFAULT_SERVICE_MINUTES),
+          isDepot(false) {}
 };
 
 struct Edge {
@@ -67,12 +86,164 @@ struct Route {
     Route() : totalDistance(0), totalCost(0.0), totalWaste(0) {}
 };
 
+/**********************************************************************************************
+SCRATCH ARENA (PER-THREAD BUMP ALLOCATOR FOR QUERY-LOCAL BUFFERS)
+Hot queries take their temporary containers from the calling thread's arena inside an
+ArenaScope. Leaving the scope rewinds the bump pointer, so once the arena has grown to a
+query's peak size, repeating that query does not touch the heap at all.
+**********************************************************************************************/
+// Counting every global operator new costs an atomic add per allocation on every thread, so
+// it is only compiled into benchmark builds (-DCOUNT_HEAP_ALLOCATIONS)
+#ifdef COUNT_HEAP_ALLOCATIONS
+atomic<long long> heapAllocations{0};   // every global operator new (read by the benchmarks)
+
+// Retries through the new_handler like the library operator new does
+static void* countedAlloc(size_t bytes, size_t align) {
+    heapAllocations.fetch_add(1, memory_order_relaxed);
+    while(true) {
+        void* p = align ? aligned_alloc(align, (max(bytes, (size_t)1) + align - 1) / align * align)
+                        : malloc(bytes ? bytes : 1);
+        if(p) return p;
+        new_handler handler = get_new_handler();
+        if(!handler) throw bad_alloc();
+        handler();
+    }
+}
+
+// Kept out of line so the compiler never pairs an inlined malloc with a free at a call site
+__attribute__((noinline)) void* operator new(size_t bytes) { return countedAlloc(bytes, 0); }
+__attribute__((noinline)) void operator delete(void* p) noexcept { free(p); }
+void* operator new[](size_t bytes) { return operator new(bytes); }
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t) noexcept { operator delete(p); }
+
+// Over-aligned requests (alignas types, pmr::new_delete_resource) are counted as well
+__attribute__((noinline)) void* operator new(size_t bytes, align_val_t align) {
+    return countedAlloc(bytes, max((size_t)align, sizeof(void*)));
+}
+__attribute__((noinline)) void operator delete(void* p, align_val_t) noexcept { free(p); }
+void* operator new[](size_t bytes, align_val_t align) { return operator new(bytes, align); }
+void operator delete[](void* p, align_val_t align) noexcept { operator delete(p, align); }
+void operator delete(void* p, size_t, align_val_t align) noexcept { operator delete(p, align); }
+void operator delete[](void* p, size_t, align_val_t align) noexcept { operator delete(p, align); }
+
+static long long heapAllocationCount() { return heapAllocations.load(); }
+#else
+static long long heapAllocationCount() { return -1; }   // not counted in this build
+#endif
+
+class ScratchArena : public pmr::memory_resource {
+private:
+    struct Chunk {
+        char* base;
+        size_t size;
+    };
+
+    static constexpr size_t FIRST_CHUNK = 64 * 1024;
+
+    vector<Chunk> chunks;
+    size_t current = 0;   // bump position: chunk index ...
+    size_t used = 0;      // ... and byte offset inside it
+
+    void* do_allocate(size_t bytes, size_t align) override {
+        while(true) {
+            if(current < chunks.size()) {
+                uintptr_t base = (uintptr_t)chunks[current].base;
+                size_t start = ((base + used + align - 1) & ~(uintptr_t)(align - 1)) - base;
+                if(start + bytes <= chunks[current].size) {
+                    used = start + bytes;
+                    return chunks[current].base + start;
+                }
+                if(current + 1 < chunks.size()) {
+                    current++;
+                    used = 0;
+                    continue;
+                }
+            }
+            size_t size = chunks.empty() ? FIRST_CHUNK : chunks.back().size * 2;
+            while(size < bytes + align) size *= 2;
+            chunks.push_back({static_cast<char*>(::operator new(size)), size});
+            current = chunks.size() - 1;
+            used = 0;
+        }
+    }
+
+    // Individual frees are ignored; memory comes back in bulk when a scope rewinds
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    struct Mark {
+        size_t chunk, offset;
+    };
+
+    ScratchArena() = default;
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    ~ScratchArena() {
+        for(auto& c : chunks) ::operator delete(c.base);
+    }
+
+    Mark mark() const { return {current, used}; }
+
+    void rewind(Mark m) {
+        current = m.chunk;
+        used = m.offset;
+        if(m.chunk == 0 && m.offset == 0 && chunks.size() > 1) {
+            // Arena is empty again: fold the chunks into one so the next query stays in it
+            size_t total = capacity();
+            for(auto& c : chunks) ::operator delete(c.base);
+            chunks.clear();
+            chunks.push_back({static_cast<char*>(::operator new(total)), total});
+        }
+    }
+
+    size_t capacity() const {
+        size_t total = 0;
+        for(auto& c : chunks) total += c.size;
+        return total;
+    }
+};
+
+bool scratchArenaEnabled = true;   // switched off by the benchmark to compare with new/delete
+
+ScratchArena& threadArena() {
+    thread_local ScratchArena arena;
+    return arena;
+}
+
+// Where query-local containers should allocate from on this thread
+pmr::memory_resource* scratchResource() {
+    return scratchArenaEnabled ? static_cast<pmr::memory_resource*>(&threadArena())
+                               : pmr::new_delete_resource();
+}
+
+// Everything allocated from the thread's arena while the scope is alive is released when it
+// ends. Scopes nest; containers using scratchResource() must not outlive the scope.
+class ArenaScope {
+private:
+    ScratchArena& arena;
+    ScratchArena::Mark saved;
+
+public:
+    ArenaScope() : arena(threadArena()), saved(arena.mark()) {}
+    ~ArenaScope() { arena.rewind(saved); }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+};
+
 /**********************************************************************************************
 HEAP DATA STRUCTURE (PRIORITY QUEUE IMPLEMENTATION)
 **********************************************************************************************/
 class MinHeap {
 private:
-    vector<pair<int, int>> heap;  // {priority, zone_id}
+    pmr::vector<pair<int, int>> heap;  // {priority, zone_id}
     int size;
     
     void heapifyUp(int index) {
@@ -110,7 +281,7 @@ private:
     }
     
 public:
-    MinHeap() : size(0) {}
+    explicit MinHeap(pmr::memory_resource* mem = pmr::get_default_resource()) : heap(mem), size(0) {}
     
     void push(int priority, int zoneId) {
         heap.push_back({priority, zoneId});
@@ -147,6 +318,169 @@ public:
     }
 };
 
+/**********************************************************************************************
+BUCKETED PRIORITY QUEUES FOR MONOTONE INTEGER KEYS
+Both need popped keys to never decrease, which Dijkstra with non-negative weights guarantees.
+They share MinHeap's push/pop/empty interface, so a search can be written once for all three.
+**********************************************************************************************/
+// Dial's algorithm: a ring of buckets at least maxWeight + 1 wide. Every queued key lies in
+// [current, current + maxWeight], so each ring slot holds a single distance value.
+class DialQueue {
+private:
+    pmr::vector<pmr::vector<int>> ring;
+    int mask;
+    int current = 0;   // key of the slot being drained
+    int count = 0;
+
+    static int ringSize(int maxWeight) {
+        int size = 1;
+        while(size <= maxWeight) size <<= 1;
+        return size;
+    }
+
+public:
+    explicit DialQueue(int maxWeight, pmr::memory_resource* mem = pmr::get_default_resource())
+        : ring(ringSize(maxWeight), mem), mask(ringSize(maxWeight) - 1) {}
+
+    void push(int key, int v) {
+        ring[key & mask].push_back(v);
+        count++;
+    }
+
+    pair<int, int> pop() {
+        if(count == 0) return {-1, -1};
+        while(ring[current & mask].empty()) current++;
+        pmr::vector<int>& slot = ring[current & mask];
+        int v = slot.back();
+        slot.pop_back();
+        count--;
+        return {current, v};
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+};
+
+// Radix heap: bucket b holds keys whose highest bit differing from the last popped key is
+// bit b-1. Popping an empty bucket 0 re-spreads the next bucket around its minimum, so each
+// entry moves down at most 32 times whatever the weights are.
+class RadixHeap {
+private:
+    pmr::vector<pmr::vector<pair<int, int>>> buckets;
+    unsigned last = 0;
+    int count = 0;
+
+    static int bucketOf(unsigned key, unsigned last) {
+        return key == last ? 0 : 32 - __builtin_clz(key ^ last);
+    }
+
+public:
+    explicit RadixHeap(pmr::memory_resource* mem = pmr::get_default_resource()) : buckets(33, mem) {}
+
+    void push(int key, int v) {
+        buckets[bucketOf(key, last)].push_back({key, v});
+        count++;
+    }
+
+    pair<int, int> pop() {
+        if(count == 0) return {-1, -1};
+        if(buckets[0].empty()) {
+            int b = 1;
+            while(buckets[b].empty()) b++;
+            unsigned smallest = UINT_MAX;
+            for(auto& e : buckets[b]) smallest = min(smallest, (unsigned)e.first);
+            last = smallest;
+            for(auto& e : buckets[b]) buckets[bucketOf(e.first, last)].push_back(e);
+            buckets[b].clear();
+        }
+        pair<int, int> top = buckets[0].back();
+        buckets[0].pop_back();
+        count--;
+        return top;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+};
+
+/**********************************************************************************************
+SINGLE-SOURCE SHORTEST PATH KERNELS — ONE SEARCH, THREE QUEUES
+Road weights are small integers, so Dial's buckets are picked whenever the largest weight fits
+a small ring; the radix heap covers any other integer weights. MinHeap stays as the reference.
+**********************************************************************************************/
+enum class PathKernel { BINARY_HEAP, DIAL_BUCKETS, RADIX_HEAP };
+
+static constexpr int DIAL_MAX_WEIGHT = 1024;   // ring of <= 2048 slots
+
+static int maxEdgeWeight(const vector<vector<Edge>>& adj) {
+    int w = 0;
+    for(auto& edges : adj)
+        for(auto& e : edges) w = max(w, e.weight);
+    return w;
+}
+
+static PathKernel choosePathKernel(int maxWeight) {
+    return maxWeight <= DIAL_MAX_WEIGHT ? PathKernel::DIAL_BUCKETS : PathKernel::RADIX_HEAP;
+}
+
+static const char* pathKernelName(PathKernel kernel) {
+    switch(kernel) {
+        case PathKernel::DIAL_BUCKETS: return "Dial's buckets";
+        case PathKernel::RADIX_HEAP: return "radix heap";
+        default: return "binary heap";
+    }
+}
+
+// distance[v] for every road node; firstHop[v] (optional) is the node after 'src' on that path
+template<class Queue>
+static void shortestPathSearch(Queue& pq, const vector<vector<Edge>>& adj, int src, int* distance, int* firstHop) {
+    int n = adj.size();
+    fill(distance, distance + n, INF);
+    if(firstHop) fill(firstHop, firstHop + n, -1);
+    distance[src] = 0;
+    if(firstHop) firstHop[src] = src;
+    pq.push(0, src);
+
+    while(!pq.empty()) {
+        pair<int, int> cur = pq.pop();
+        int u = cur.second;
+        if(cur.first > distance[u]) continue;   // stale entry
+
+        for(auto& e : adj[u]) {
+            int nd = cur.first + e.weight;
+            if(nd < distance[e.to]) {
+                distance[e.to] = nd;
+                if(firstHop) firstHop[e.to] = (u == src) ? e.to : firstHop[u];
+                pq.push(nd, e.to);
+            }
+        }
+    }
+}
+
+// Queue storage comes from the calling thread's scratch arena
+static void shortestPaths(const vector<vector<Edge>>& adj, int src, int maxWeight, PathKernel kernel,
+                          int* distance, int* firstHop = nullptr) {
+    ArenaScope scope;
+    switch(kernel) {
+        case PathKernel::DIAL_BUCKETS: {
+            DialQueue pq(maxWeight, scratchResource());
+            shortestPathSearch(pq, adj, src, distance, firstHop);
+            break;
+        }
+        case PathKernel::RADIX_HEAP: {
+            RadixHeap pq(scratchResource());
+            shortestPathSearch(pq, adj, src, distance, firstHop);
+            break;
+        }
+        default: {
+            MinHeap pq(scratchResource());
+            shortestPathSearch(pq, adj, src, distance, firstHop);
+        }
+    }
+}
+
 /**********************************************************************************************
 SEGMENT TREE FOR WASTE PREDICTION AND QUERIES
 **********************************************************************************************/
@@ -216,95 +550,6 @@ public:
     }
 };
 
-/**********************************************************************************************
-SORTING ALGORITHMS
-**********************************************************************************************/
-class SortingAlgorithms {
-public:
-    // Quick Sort Implementation
-    static void quickSort(vector<Zone>& zones, int low, int high, bool byWaste = true) {
-        if (low < high) {
-            int pivot = partition(zones, low, high, byWaste);
-            quickSort(zones, low, pivot - 1, byWaste);
-            quickSort(zones, pivot + 1, high, byWaste);
-        }
-    }
-    
-private:
-    static int partition(vector<Zone>& zones, int low, int high, bool byWaste) {
-        Zone pivot = zones[high];
-        int i = low - 1;
-        
-        for (int j = low; j < high; j++) {
-            bool condition = byWaste ? 
-                (zones[j].currentWaste > pivot.currentWaste) : 
-                (zones[j].id < pivot.id);
-                
-            if (condition) {
-                i++;
-                swap(zones[i], zones[j]);
-            }
-        }
-        swap(zones[i + 1], zones[high]);
-        return i + 1;
-    }
-    
-public:
-    // Merge Sort Implementation
-    static void mergeSort(vector<Zone>& zones, int left, int right, bool byWaste = true) {
-        if (left < right) {
-            int mid = left + (right - left) / 2;
-            mergeSort(zones, left, mid, byWaste);
-            mergeSort(zones, mid + 1, right, byWaste);
-            merge(zones, left, mid, right, byWaste);
-        }
-    }
-    
-private:
-    static void merge(vector<Zone>& zones, int left, int mid, int right, bool byWaste) {
-        int n1 = mid - left + 1;
-        int n2 = right - mid;
-        
-        vector<Zone> leftArr(n1), rightArr(n2);
-        
-        for (int i = 0; i < n1; i++) {
-            leftArr[i] = zones[left + i];
-        }
-        for (int j = 0; j < n2; j++) {
-            rightArr[j] = zones[mid + 1 + j];
-        }
-        
-        int i = 0, j = 0, k = left;
-        
-        while (i < n1 && j < n2) {
-            bool condition = byWaste ?
-                (leftArr[i].currentWaste >= rightArr[j].currentWaste) :
-                (leftArr[i].id <= rightArr[j].id);
-                
-            if (condition) {
-                zones[k] = leftArr[i];
-                i++;
-            } else {
-                zones[k] = rightArr[j];
-                j++;
-            }
-            k++;
-        }
-        
-        while (i < n1) {
-            zones[k] = leftArr[i];
-            i++;
-            k++;
-        }
-        
-        while (j < n2) {
-            zones[k] = rightArr[j];
-            j++;
-            k++;
-        }
-    }
-};
-
 /**********************************************************************************************
 LOOKUP TABLE FOR FAST ZONE SEARCH
 **********************************************************************************************/
@@ -376,82 +621,4120 @@ public:
 };
 
 /**********************************************************************************************
-MAIN CLASS - WasteRoutePlanner
+COMPACT DISTANCE MATRIX — ONE ALLOCATION, UINT16 CELLS WHEN DISTANCES FIT (0xFFFF = UNREACHABLE),
+INT32 OTHERWISE, WITH OPTIONAL TILED (BLOCKED) LAYOUT
 **********************************************************************************************/
-class WasteRoutePlanner {
+class DistanceMatrix {
+public:
+    static constexpr uint16_t NARROW_INF = 0xFFFF;
+    static const int TILE = 32;     // 32x32 uint16 tile = 2 KB, fits comfortably in L1
+
+    // Read-only view of one row; dist[i][j] keeps working for callers
+    class RowView {
+    private:
+        const uint16_t* p16;
+        const int32_t* p32;
+        bool tiled;
+
+        static size_t offset(int j, bool tiled) {
+            return tiled ? (size_t)(j / TILE) * TILE * TILE + (j % TILE) : (size_t)j;
+        }
+
+    public:
+        RowView(const uint16_t* narrow, const int32_t* wide, bool tiledLayout)
+            : p16(narrow), p32(wide), tiled(tiledLayout) {}
+
+        int operator[](int j) const {
+            size_t k = offset(j, tiled);
+            if(p16) return p16[k] == NARROW_INF ? INF : p16[k];
+            return p32[k];
+        }
+
+        // Contiguous uint16 row (row-major narrow matrices only, nullptr otherwise)
+        const uint16_t* narrowData() const {
+            return tiled ? nullptr : p16;
+        }
+
+        // Contiguous int row (row-major wide matrices only, nullptr otherwise)
+        const int32_t* wideData() const {
+            return tiled ? nullptr : p32;
+        }
+    };
 
 private:
+    int n;
+    int padded;            // n rounded up to a multiple of TILE when tiled
+    bool narrow;
+    bool tiled;
+    vector<uint16_t> cells16;
+    vector<int32_t> cells32;
+
+    size_t rowBase(int i) const {
+        if(!tiled) return (size_t)i * n;
+        return (size_t)(i / TILE) * padded * TILE + (size_t)(i % TILE) * TILE;
+    }
 
-    vector<Zone> zones;
-    unordered_map<string,int> id;
-    vector<vector<Edge>> adj;
-    vector<vector<int>> dist;
-    LookupTable lookupTable;
-    
-    int dumpingYard;
-    vector<int> referenceDayWaste;
-    vector<SegmentTree*> segmentTrees;  // One per zone for history analysis
-    
-    // Route comparison storage
-    vector<Route> savedRoutes;
+    size_t index(int i, int j) const {
+        if(!tiled) return (size_t)i * n + j;
+        return rowBase(i) + (size_t)(j / TILE) * TILE * TILE + (j % TILE);
+    }
 
 public:
+    DistanceMatrix() : n(0), padded(0), narrow(true), tiled(false) {}
+
+    // Compresses a row-major n x n table (INF = unreachable)
+    void assign(const vector<int>& flat, int size, bool tiledLayout = false) {
+        generate(size, [&](int i, int j) { return flat[(size_t)i * size + j]; }, tiledLayout);
+    }
+
+    // Same, but cells come from cell(i, j) so large synthetic matrices need no int copy.
+    // cell() is called twice per entry (width probe, then fill) and must be deterministic.
+    template<class CellFn>
+    void generate(int size, CellFn cell, bool tiledLayout = false) {
+        n = size;
+        tiled = tiledLayout;
+        padded = tiled ? (n + TILE - 1) / TILE * TILE : n;
+
+        int maxFinite = 0;
+        for(int i = 0; i < n; i++)
+            for(int j = 0; j < n; j++) {
+                int v = cell(i, j);
+                if(v != INF) maxFinite = max(maxFinite, v);
+            }
+        narrow = maxFinite < NARROW_INF;
+
+        size_t cells = (size_t)padded * padded;
+        cells16.clear();
+        cells32.clear();
+        cells16.shrink_to_fit();
+        cells32.shrink_to_fit();
+        if(narrow) cells16.assign(cells, NARROW_INF);
+        else cells32.assign(cells, INF);
+
+        for(int i = 0; i < n; i++) {
+            for(int j = 0; j < n; j++) {
+                int v = cell(i, j);
+                if(narrow) cells16[index(i, j)] = (v == INF) ? NARROW_INF : (uint16_t)v;
+                else cells32[index(i, j)] = v;
+            }
+        }
+    }
+
+    int at(int i, int j) const {
+        size_t k = index(i, j);
+        if(narrow) return cells16[k] == NARROW_INF ? INF : cells16[k];
+        return cells32[k];
+    }
+
+    RowView operator[](int i) const {
+        size_t base = rowBase(i);
+        return RowView(narrow ? &cells16[base] : nullptr, narrow ? nullptr : &cells32[base], tiled);
+    }
+
+    int size() const { return n; }
+    bool isNarrow() const { return narrow; }
+    bool isTiled() const { return tiled; }
+
+    size_t memoryBytes() const {
+        return narrow ? cells16.size() * sizeof(uint16_t) : cells32.size() * sizeof(int32_t);
+    }
+};
 
 /**********************************************************************************************
-DISPLAY ALL DRIVERS (ADMIN ONLY)
+VISITED BITMASK (ONE BIT PER ZONE, 64 ZONES PER WORD)
 **********************************************************************************************/
-void displayAllDrivers() {
-    system("cls");
-
-    cout << BLUE << "=============== REGISTERED DRIVERS LIST ===============\n" << RESET;
+class VisitedMask {
+private:
+    pmr::vector<uint64_t> words;
+    int n;
 
-    ifstream file("drivers.txt");
+public:
+    explicit VisitedMask(int size = 0, pmr::memory_resource* mem = pmr::get_default_resource())
+        : words(mem) {
+        reset(size);
+    }
 
-    if (!file) {
-        cout << RED << "Error: drivers.txt file not found.\n" << RESET;
-        return;
+    void reset(int size) {
+        n = size;
+        words.assign((size + 63) / 64 + 1, 0);   // +1 word so SIMD tails can read ahead
     }
 
-    string username, password;
-    int count = 0;
+    void set(int i) { words[i >> 6] |= (uint64_t(1) << (i & 63)); }
+    void clear(int i) { words[i >> 6] &= ~(uint64_t(1) << (i & 63)); }
+    bool test(int i) const { return (words[i >> 6] >> (i & 63)) & 1; }
+    int size() const { return n; }
+    const uint64_t* data() const { return words.data(); }
+};
 
-    cout << left << setw(10) << "ID"
-         << setw(25) << "DRIVER USERNAME" << "\n";
-    cout << "-------------------------------------------------------\n";
+/**********************************************************************************************
+MASKED ARGMIN KERNELS — "NEAREST UNVISITED" SCAN OVER ONE DISTANCE ROW
+Returns the first index with the smallest reachable value whose bit is clear in 'blocked',
+or -1. AVX-512BW / AVX2 paths are chosen at compile time (-march=native), scalar otherwise.
+**********************************************************************************************/
+static inline uint32_t maskBits(const uint64_t* blocked, int j, int width) {
+    // 'width' (16 or 32) bits of the mask starting at bit j; j is a multiple of width
+    return (uint32_t)(blocked[j >> 6] >> (j & 63)) & (width == 32 ? 0xFFFFFFFFu : 0xFFFFu);
+}
 
-    while (file >> username >> password) {
-        cout << left << setw(10) << (++count)
-             << setw(25) << username << "\n";
+static int maskedArgminScalar(const uint16_t* row, const uint64_t* blocked, int from, int n, int& bestValue) {
+    // Walk only the open bits of each mask word, so late in a tour most of the row is skipped
+    int best = -1;
+    for(int base = from & ~63; base < n; base += 64) {
+        uint64_t open = ~blocked[base >> 6];
+        if(base < from) open &= ~uint64_t(0) << (from - base);
+        if(n - base < 64) open &= (uint64_t(1) << (n - base)) - 1;
+        while(open) {
+            int j = base + __builtin_ctzll(open);
+            open &= open - 1;
+            if(row[j] < bestValue) {
+                bestValue = row[j];
+                best = j;
+            }
+        }
     }
+    return best;
+}
 
-    file.close();
+static int maskedArgmin(const uint16_t* row, const uint64_t* blocked, int n, int& bestValue) {
+    bestValue = DistanceMatrix::NARROW_INF;   // unreachable cells are never selected
+    int j = 0;
+    int best = -1;
+
+#if defined(__AVX512BW__)
+    __m512i acc = _mm512_set1_epi16((short)0xFFFF);
+    for(; j + 32 <= n; j += 32) {
+        __mmask32 open = ~(__mmask32)maskBits(blocked, j, 32);
+        __m512i v = _mm512_loadu_si512((const void*)(row + j));
+        acc = _mm512_mask_min_epu16(acc, open, acc, v);
+    }
+    alignas(64) uint16_t lanes[32];
+    _mm512_store_si512((void*)lanes, acc);
+    uint16_t vmin = 0xFFFF;
+    for(int k = 0; k < 32; k++) vmin = min(vmin, lanes[k]);
+
+    if(vmin != 0xFFFF) {
+        __m512i target = _mm512_set1_epi16((short)vmin);
+        for(int k = 0; k + 32 <= j; k += 32) {
+            __mmask32 open = ~(__mmask32)maskBits(blocked, k, 32);
+            __m512i v = _mm512_loadu_si512((const void*)(row + k));
+            __mmask32 hit = _mm512_mask_cmpeq_epu16_mask(open, v, target);
+            if(hit) {
+                best = k + __builtin_ctz(hit);
+                bestValue = vmin;
+                break;
+            }
+        }
+    }
+#elif defined(__AVX2__)
+    const __m256i bitSel = _mm256_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048,
+                                             4096, 8192, 16384, (short)0x8000);
+    __m256i acc = _mm256_set1_epi16((short)0xFFFF);
+    for(; j + 16 <= n; j += 16) {
+        __m256i bits = _mm256_set1_epi16((short)maskBits(blocked, j, 16));
+        __m256i closed = _mm256_cmpeq_epi16(_mm256_and_si256(bits, bitSel), bitSel);
+        __m256i v = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(row + j)), closed);
+        acc = _mm256_min_epu16(acc, v);
+    }
+    __m128i m128 = _mm_min_epu16(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    // minpos works on unsigned 16-bit lanes and returns the minimum in the low word
+    uint16_t vmin = (uint16_t)_mm_cvtsi128_si32(_mm_minpos_epu16(m128));
+
+    if(vmin != 0xFFFF) {
+        __m256i target = _mm256_set1_epi16((short)vmin);
+        for(int k = 0; k + 16 <= j; k += 16) {
+            __m256i bits = _mm256_set1_epi16((short)maskBits(blocked, k, 16));
+            __m256i closed = _mm256_cmpeq_epi16(_mm256_and_si256(bits, bitSel), bitSel);
+            __m256i v = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(row + k)), closed);
+            uint32_t hit = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi16(v, target));
+            if(hit) {
+                best = k + __builtin_ctz(hit) / 2;
+                bestValue = vmin;
+                break;
+            }
+        }
+    }
+#endif
+
+    // Tail (or the whole row without SIMD); strict '<' keeps the earliest index on ties
+    int tailValue = bestValue;
+    int tail = maskedArgminScalar(row, blocked, j, n, tailValue);
+    if(tail != -1 && tailValue < bestValue) {
+        bestValue = tailValue;
+        best = tail;
+    }
+    if(best == -1) bestValue = INF;
+    return best;
+}
 
-    if (count == 0) {
-        cout << YELLOW << "No drivers registered yet.\n" << RESET;
+// Same contract for int rows (wide matrices and stop-set tables); INF is never selected
+static int maskedArgmin(const int* row, const uint64_t* blocked, int n, int& bestValue) {
+    bestValue = INF;
+    int best = -1;
+    int j = 0;
+
+#if defined(__AVX2__)
+    const __m256i bitSel = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const __m256i inf = _mm256_set1_epi32(INF);
+    __m256i acc = inf;
+    for(; j + 8 <= n; j += 8) {
+        __m256i bits = _mm256_set1_epi32((int)((blocked[j >> 6] >> (j & 63)) & 0xFF));
+        __m256i closed = _mm256_cmpeq_epi32(_mm256_and_si256(bits, bitSel), bitSel);
+        __m256i v = _mm256_blendv_epi8(_mm256_loadu_si256((const __m256i*)(row + j)), inf, closed);
+        acc = _mm256_min_epi32(acc, v);
+    }
+    alignas(32) int lanes[8];
+    _mm256_store_si256((__m256i*)lanes, acc);
+    int vmin = INF;
+    for(int k = 0; k < 8; k++) vmin = min(vmin, lanes[k]);
+
+    if(vmin != INF) {
+        for(int k = 0; k < j; k++) {
+            if(row[k] == vmin && !((blocked[k >> 6] >> (k & 63)) & 1)) {
+                best = k;
+                bestValue = vmin;
+                break;
+            }
+        }
     }
+#endif
 
-    cout << "-------------------------------------------------------\n";
-    cout << GREEN << "Total Drivers: " << count << RESET << "\n";
+    for(; j < n; j++) {
+        if((blocked[j >> 6] >> (j & 63)) & 1) continue;
+        if(row[j] < bestValue) {
+            bestValue = row[j];
+            best = j;
+        }
+    }
+    return best;
 }
 
+// Nearest zone in a distance row whose bit is clear in 'blocked' (-1 if none is reachable)
+static int nearestUnvisited(const DistanceMatrix::RowView& row, const VisitedMask& blocked, int& bestValue) {
+    int n = blocked.size();
+    if(const uint16_t* p = row.narrowData()) return maskedArgmin(p, blocked.data(), n, bestValue);
+    if(const int32_t* p = row.wideData()) return maskedArgmin(p, blocked.data(), n, bestValue);
+
+    // Tiled layout: no contiguous row, fall back to the element-wise view
+    int best = -1;
+    bestValue = INF;
+    for(int j = 0; j < n; j++)
+        if(!blocked.test(j) && row[j] < bestValue)
+            bestValue = row[j], best = j;
+    return best;
+}
 
 /**********************************************************************************************
-LOAD ZONES FROM FILE
+CONTRACTION HIERARCHIES (PREPROCESSED SHORTEST PATH QUERIES)
 **********************************************************************************************/
-void loadZonesFromFile(const string& filename) {
-    ifstream file(filename);
+class ContractionHierarchy {
+private:
+    struct Arc {
+        int to;
+        int weight;
+        int middle;   // -1 for an original road, otherwise the contracted node it bypasses
+    };
 
-    if (!file) {
-        cout << RED << "Error: Unable to open " << filename << RESET << "\n";
-        exit(1);
+    int n;
+    vector<int> rank;              // contraction order, higher = more important
+    vector<vector<Arc>> up;        // arcs towards higher ranked nodes (roads are two-way)
+    int shortcutCount;
+
+    // Query scratch space (reused between queries, reset through touched lists)
+    vector<int> distF, distB, parentF, parentB;
+    vector<int> touchedF, touchedB;
+    vector<vector<pair<int, int>>> buckets;   // many-to-many: {target index, distance}
+    vector<int> touchedBuckets;
+
+    static constexpr uint32_t FILE_MAGIC = 0x48435257;   // "WRCH"
+    static constexpr int FILE_VERSION = 1;
+
+    /******************************************************************************************
+    PREPROCESSING HELPERS
+    ******************************************************************************************/
+    struct BuildState {
+        vector<vector<Arc>> g;
+        vector<bool> contracted;
+        vector<int> deletedNeighbors;
+        vector<int> wdist;
+        vector<int> wtouched;
+    };
+
+    // Bounded Dijkstra from source that ignores 'avoid' and already contracted nodes
+    void witnessSearch(BuildState& st, int source, int avoid, int limit, int maxSettled) {
+        for(int v : st.wtouched) st.wdist[v] = INF;
+        st.wtouched.clear();
+
+        MinHeap pq;
+        st.wdist[source] = 0;
+        st.wtouched.push_back(source);
+        pq.push(0, source);
+        int settled = 0;
+
+        while(!pq.empty()) {
+            pair<int, int> cur = pq.pop();
+            int u = cur.second;
+            if(cur.first > st.wdist[u]) continue;
+            if(cur.first > limit || ++settled > maxSettled) break;
+
+            for(auto& a : st.g[u]) {
+                if(a.to == avoid || st.contracted[a.to]) continue;
+                int nd = cur.first + a.weight;
+                if(nd < st.wdist[a.to]) {
+                    if(st.wdist[a.to] == INF) st.wtouched.push_back(a.to);
+                    st.wdist[a.to] = nd;
+                    pq.push(nd, a.to);
+                }
+            }
+        }
     }
 
-    zones.clear();
-    lookupTable.clear();
-    id.clear();
+    // Counts (simulate = true) or inserts the shortcuts needed to contract v
+    int contractNode(BuildState& st, int v, bool simulate) {
+        vector<Arc> nb;
+        for(auto& a : st.g[v]) {
+            if(!st.contracted[a.to]) nb.push_back(a);
+        }
 
-    int zid, waste;
-    double x, y;
+        int added = 0;
+        for(int i = 0; i < (int)nb.size(); i++) {
+            int limit = 0;
+            for(int j = i + 1; j < (int)nb.size(); j++) {
+                limit = max(limit, nb[i].weight + nb[j].weight);
+            }
+            if(limit == 0) continue;
+
+            witnessSearch(st, nb[i].to, v, limit, 500);
+
+            for(int j = i + 1; j < (int)nb.size(); j++) {
+                int viaV = nb[i].weight + nb[j].weight;
+                if(st.wdist[nb[j].to] <= viaV) continue;
+
+                added++;
+                if(!simulate) {
+                    addOrImprove(st.g[nb[i].to], nb[j].to, viaV, v);
+                    addOrImprove(st.g[nb[j].to], nb[i].to, viaV, v);
+                }
+            }
+        }
+        return added;
+    }
+
+    static void addOrImprove(vector<Arc>& arcs, int to, int weight, int middle) {
+        for(auto& a : arcs) {
+            if(a.to == to) {
+                if(weight < a.weight) {
+                    a.weight = weight;
+                    a.middle = middle;
+                }
+                return;
+            }
+        }
+        arcs.push_back({to, weight, middle});
+    }
+
+    int nodePriority(BuildState& st, int v) {
+        int degree = 0;
+        for(auto& a : st.g[v]) {
+            if(!st.contracted[a.to]) degree++;
+        }
+        return contractNode(st, v, true) - degree + st.deletedNeighbors[v];
+    }
+
+    /******************************************************************************************
+    QUERY HELPERS
+    ******************************************************************************************/
+    void resetSearch(vector<int>& d, vector<int>& parent, vector<int>& touched) {
+        for(int v : touched) {
+            d[v] = INF;
+            parent[v] = -1;
+        }
+        touched.clear();
+    }
+
+    // Stall-on-demand: u is reached more cheaply through a higher ranked neighbour
+    bool stalled(int u, const vector<int>& d) const {
+        for(auto& a : up[u]) {
+            if(d[a.to] != INF && d[a.to] + a.weight < d[u]) return true;
+        }
+        return false;
+    }
+
+    // Exhaustive search in the upward graph (search spaces stay small after contraction)
+    void upwardSearch(int s, vector<int>& d, vector<int>& parent, vector<int>& touched) {
+        resetSearch(d, parent, touched);
+        ArenaScope scope;
+        RadixHeap pq(scratchResource());
+        d[s] = 0;
+        touched.push_back(s);
+        pq.push(0, s);
+
+        while(!pq.empty()) {
+            pair<int, int> cur = pq.pop();
+            int u = cur.second;
+            if(cur.first > d[u] || stalled(u, d)) continue;
+
+            for(auto& a : up[u]) {
+                int nd = cur.first + a.weight;
+                if(nd < d[a.to]) {
+                    if(d[a.to] == INF) touched.push_back(a.to);
+                    d[a.to] = nd;
+                    parent[a.to] = u;
+                    pq.push(nd, a.to);
+                }
+            }
+        }
+    }
+
+    const Arc* findArc(int a, int b) const {
+        int low = rank[a] < rank[b] ? a : b;
+        int high = (low == a) ? b : a;
+        for(auto& arc : up[low]) {
+            if(arc.to == high) return &arc;
+        }
+        return nullptr;
+    }
+
+    // Appends the original road nodes from a (exclusive) to b (inclusive)
+    void unpackArc(int a, int b, vector<int>& out) const {
+        const Arc* arc = findArc(a, b);
+        if(arc == nullptr || arc->middle == -1) {
+            out.push_back(b);
+            return;
+        }
+        unpackArc(a, arc->middle, out);
+        unpackArc(arc->middle, b, out);
+    }
+
+    void prepareScratch() {
+        distF.assign(n, INF);
+        distB.assign(n, INF);
+        parentF.assign(n, -1);
+        parentB.assign(n, -1);
+        touchedF.clear();
+        touchedB.clear();
+        buckets.assign(n, {});
+        touchedBuckets.clear();
+    }
+
+public:
+    ContractionHierarchy() : n(0), shortcutCount(0) {}
+
+    bool ready() const {
+        return n > 0;
+    }
+
+    int size() const {
+        return n;
+    }
+
+    int getShortcutCount() const {
+        return shortcutCount;
+    }
+
+    // Identifies the road graph a saved hierarchy was built from (FNV-1a over all edges)
+    static uint64_t fingerprint(const vector<vector<Edge>>& adj) {
+        uint64_t h = 1469598103934665603ULL;
+        auto mix = [&h](uint64_t v) {
+            h ^= v;
+            h *= 1099511628211ULL;
+        };
+        mix(adj.size());
+        for(int u = 0; u < (int)adj.size(); u++) {
+            for(auto& e : adj[u]) {
+                mix(u);
+                mix(e.to);
+                mix(e.weight);
+            }
+        }
+        return h;
+    }
+
+    /******************************************************************************************
+    BUILD — NODE ORDERING BY EDGE DIFFERENCE WITH LAZY UPDATES
+    ******************************************************************************************/
+    void build(const vector<vector<Edge>>& adj) {
+        n = adj.size();
+        BuildState st;
+        st.g.assign(n, {});
+        st.contracted.assign(n, false);
+        st.deletedNeighbors.assign(n, 0);
+        st.wdist.assign(n, INF);
+
+        for(int u = 0; u < n; u++) {
+            for(auto& e : adj[u]) {
+                if(e.to != u) addOrImprove(st.g[u], e.to, e.weight, -1);
+            }
+        }
+
+        MinHeap order;
+        for(int v = 0; v < n; v++) {
+            order.push(nodePriority(st, v), v);
+        }
+
+        rank.assign(n, 0);
+        up.assign(n, {});
+        shortcutCount = 0;
+        int nextRank = 0;
+
+        while(!order.empty()) {
+            pair<int, int> top = order.pop();
+            int v = top.second;
+            if(st.contracted[v]) continue;
+
+            // Lazy update: re-evaluate and postpone if v is no longer the cheapest node
+            int current = nodePriority(st, v);
+            if(!order.empty() && current > order.top().first) {
+                order.push(current, v);
+                continue;
+            }
+
+            shortcutCount += contractNode(st, v, false);
+            for(auto& a : st.g[v]) {
+                if(st.contracted[a.to]) continue;
+                up[v].push_back(a);
+                st.deletedNeighbors[a.to]++;
+            }
+            st.contracted[v] = true;
+            rank[v] = nextRank++;
+        }
+
+        prepareScratch();
+    }
+
+    /******************************************************************************************
+    POINT-TO-POINT QUERIES (BIDIRECTIONAL UPWARD DIJKSTRA)
+    ******************************************************************************************/
+    int query(int s, int t, int* meetingNode = nullptr) {
+        if(s == t) {
+            if(meetingNode) *meetingNode = s;
+            return 0;
+        }
+
+        resetSearch(distF, parentF, touchedF);
+        resetSearch(distB, parentB, touchedB);
+
+        ArenaScope scope;
+        RadixHeap pqF(scratchResource()), pqB(scratchResource());   // shortcut weights can be large
+        distF[s] = 0; touchedF.push_back(s); pqF.push(0, s);
+        distB[t] = 0; touchedB.push_back(t); pqB.push(0, t);
+
+        int best = INF, meet = -1;
+        bool forward = true;
+
+        while(!pqF.empty() || !pqB.empty()) {
+            if(forward && pqF.empty()) forward = false;
+            if(!forward && pqB.empty()) forward = true;
+
+            RadixHeap& pq = forward ? pqF : pqB;
+            vector<int>& d = forward ? distF : distB;
+            vector<int>& other = forward ? distB : distF;
+            vector<int>& parent = forward ? parentF : parentB;
+            vector<int>& touched = forward ? touchedF : touchedB;
+
+            pair<int, int> cur = pq.pop();
+            int u = cur.second;
+
+            if(cur.first >= best) {
+                // This direction cannot improve the answer any more
+                while(!pq.empty()) pq.pop();
+                forward = !forward;
+                continue;
+            }
+
+            if(cur.first <= d[u]) {
+                if(other[u] != INF && cur.first + other[u] < best) {
+                    best = cur.first + other[u];
+                    meet = u;
+                }
+
+                if(!stalled(u, d)) {
+                    for(auto& a : up[u]) {
+                        int nd = cur.first + a.weight;
+                        if(nd < d[a.to]) {
+                            if(d[a.to] == INF) touched.push_back(a.to);
+                            d[a.to] = nd;
+                            parent[a.to] = u;
+                            pq.push(nd, a.to);
+                        }
+                    }
+                }
+            }
+            forward = !forward;
+        }
+
+        if(meetingNode) *meetingNode = meet;
+        return best;
+    }
+
+    // Full road-level path s -> t (empty when unreachable)
+    vector<int> path(int s, int t) {
+        if(s == t) return {s};
+
+        int meet;
+        int d = query(s, t, &meet);
+        vector<int> result;
+        if(d == INF) return result;
+
+        vector<int> upChain;   // s ... meet
+        for(int v = meet; v != -1; v = parentF[v]) upChain.push_back(v);
+        reverse(upChain.begin(), upChain.end());
+
+        result.push_back(s);
+        for(int i = 1; i < (int)upChain.size(); i++) unpackArc(upChain[i-1], upChain[i], result);
+        for(int v = meet; parentB[v] != -1; v = parentB[v]) unpackArc(v, parentB[v], result);
+
+        return result;
+    }
+
+    /******************************************************************************************
+    MANY-TO-MANY DISTANCE TABLE (BUCKET BASED)
+    ******************************************************************************************/
+    vector<vector<int>> manyToMany(const vector<int>& sources, const vector<int>& targets) {
+        vector<vector<int>> table(sources.size());
+
+        bucketTargets(targets.data(), targets.size());
+        for(int i = 0; i < (int)sources.size(); i++) {
+            table[i].resize(targets.size());
+            scanSource(sources[i], table[i].data(), targets.size());
+        }
+
+        return table;
+    }
+
+    // Same table written row-major into 'out' (sources x targets). Bucket lists keep their
+    // capacity between calls, so this is allocation free once warm.
+    void manyToMany(const int* sources, int sourceCount, const int* targets, int targetCount, int* out) {
+        bucketTargets(targets, targetCount);
+        for(int i = 0; i < sourceCount; i++) {
+            scanSource(sources[i], out + (size_t)i * targetCount, targetCount);
+        }
+    }
+
+private:
+    void bucketTargets(const int* targets, int targetCount) {
+        for(int v : touchedBuckets) buckets[v].clear();
+        touchedBuckets.clear();
+
+        for(int j = 0; j < targetCount; j++) {
+            upwardSearch(targets[j], distB, parentB, touchedB);
+            for(int v : touchedB) {
+                if(buckets[v].empty()) touchedBuckets.push_back(v);
+                buckets[v].push_back({j, distB[v]});
+            }
+        }
+    }
+
+    void scanSource(int s, int* row, int targetCount) {
+        fill(row, row + targetCount, INF);
+        upwardSearch(s, distF, parentF, touchedF);
+        for(int v : touchedF) {
+            for(auto& entry : buckets[v]) {
+                row[entry.first] = min(row[entry.first], distF[v] + entry.second);
+            }
+        }
+    }
+
+public:
+
+    /******************************************************************************************
+    PERSISTENCE (BINARY FILE, REBUILT WHEN THE ROAD GRAPH CHANGES)
+    ******************************************************************************************/
+    bool save(const string& filename, uint64_t graphFingerprint) const {
+        ofstream file(filename, ios::binary);
+        if(!file) return false;
+
+        auto put = [&file](const auto& v) {
+            file.write(reinterpret_cast<const char*>(&v), sizeof(v));
+        };
+
+        put(FILE_MAGIC);
+        put(FILE_VERSION);
+        put(graphFingerprint);
+        put(n);
+        put(shortcutCount);
+        for(int v = 0; v < n; v++) {
+            put(rank[v]);
+            int count = up[v].size();
+            put(count);
+            for(auto& a : up[v]) {
+                put(a.to);
+                put(a.weight);
+                put(a.middle);
+            }
+        }
+        return bool(file);
+    }
+
+    bool load(const string& filename, uint64_t graphFingerprint) {
+        ifstream file(filename, ios::binary);
+        if(!file) return false;
+
+        auto get = [&file](auto& v) {
+            file.read(reinterpret_cast<char*>(&v), sizeof(v));
+        };
+
+        uint32_t magic = 0;
+        int version = 0, count = 0;
+        uint64_t fp = 0;
+        get(magic);
+        get(version);
+        get(fp);
+        if(!file || magic != FILE_MAGIC || version != FILE_VERSION || fp != graphFingerprint) {
+            return false;
+        }
+
+        get(n);
+        get(shortcutCount);
+        if(!file || n <= 0) {
+            n = 0;
+            return false;
+        }
+
+        // A corrupt file must not leave a half-filled hierarchy or arcs pointing off the graph
+        rank.assign(n, 0);
+        up.assign(n, {});
+        bool valid = true;
+        for(int v = 0; v < n && file && valid; v++) {
+            get(rank[v]);
+            get(count);
+            if(count < 0 || count > n) {
+                valid = false;
+                break;
+            }
+            up[v].resize(count);
+            for(auto& a : up[v]) {
+                get(a.to);
+                get(a.weight);
+                get(a.middle);
+                if(a.to < 0 || a.to >= n || a.weight < 0 || a.middle < -1 || a.middle >= n) valid = false;
+            }
+        }
+
+        if(!file || !valid) {
+            n = 0;
+            rank.clear();
+            up.clear();
+            return false;
+        }
+
+        prepareScratch();
+        return true;
+    }
+};
+
+/**********************************************************************************************
+NEXT-HOP MATRIX FOR ROAD-LEVEL PATH RECONSTRUCTION
+**********************************************************************************************/
+class NextHopMatrix {
+private:
+    int n;
+    bool compact;              // int16 storage while every zone index fits (n < 32768)
+    vector<int16_t> hop16;
+    vector<int32_t> hop32;
+
+public:
+    NextHopMatrix() : n(0), compact(true) {}
+
+    void reset(int size) {
+        n = size;
+        compact = size < 32768;
+        hop16.clear();
+        hop32.clear();
+        if(compact) hop16.assign((size_t)n * n, -1);
+        else hop32.assign((size_t)n * n, -1);
+    }
+
+    void set(int from, int to, int hop) {
+        size_t idx = (size_t)from * n + to;
+        if(compact) hop16[idx] = (int16_t)hop;
+        else hop32[idx] = hop;
+    }
+
+    // First road node after 'from' on the shortest path to 'to' (-1 when unreachable)
+    int get(int from, int to) const {
+        size_t idx = (size_t)from * n + to;
+        return compact ? hop16[idx] : hop32[idx];
+    }
+
+    int size() const {
+        return n;
+    }
+
+    size_t memoryBytes() const {
+        return compact ? hop16.size() * sizeof(int16_t) : hop32.size() * sizeof(int32_t);
+    }
+};
+
+/**********************************************************************************************
+LAZY ROAD-LEVEL EXPANSION OF A ROUTE (ONE ROAD NODE PER CALL)
+**********************************************************************************************/
+class RouteRoadCursor {
+private:
+    const NextHopMatrix* hops;
+    const vector<int>* stops;
+    int leg;        // index of the stop we are currently driving towards
+    int current;    // road node we are standing on
+    bool started;
+
+public:
+    RouteRoadCursor(const NextHopMatrix& matrix, const vector<int>& path)
+        : hops(&matrix), stops(&path), leg(1), current(-1), started(false) {}
+
+    bool done() const {
+        return stops->empty() || (started && leg >= (int)stops->size());
+    }
+
+    // Returns the next road node, or -1 when the route is exhausted or a leg is unreachable
+    int next() {
+        if(done()) return -1;
+
+        if(!started) {
+            started = true;
+            current = (*stops)[0];
+        } else {
+            int hop = hops->get(current, (*stops)[leg]);
+            if(hop == -1) {
+                leg = stops->size();
+                return -1;
+            }
+            current = hop;
+        }
+
+        // Skip every stop we are now standing on (also handles repeated stops)
+        while(leg < (int)stops->size() && current == (*stops)[leg]) leg++;
+        return current;
+    }
+};
+
+/**********************************************************************************************
+WORK-STEALING THREAD POOL — PER-WORKER DEQUES + FORK/JOIN HELPERS
+Owners push/pop at the back of their own deque (LIFO, cache-warm); idle workers steal from
+the front of someone else's (FIFO, the biggest untouched pieces). Threads waiting on a
+TaskGroup run tasks instead of blocking, so nested parallel loops cannot deadlock.
+Queue 0 belongs to threads outside the pool (the menu thread), which help while they wait.
+**********************************************************************************************/
+class WorkStealingPool {
+public:
+    using Task = function<void()>;
+
+    class TaskGroup {
+    private:
+        WorkStealingPool& pool;
+        atomic<int> pending{0};
+
+    public:
+        explicit TaskGroup(WorkStealingPool& p) : pool(p) {}
+        ~TaskGroup() { wait(); }
+
+        void run(Task task) {
+            pending++;
+            pool.submit([this, task = move(task)]() {
+                task();
+                pending--;
+            });
+        }
+
+        void wait() {
+            while(pending > 0) {
+                if(!pool.runOne()) this_thread::yield();
+            }
+        }
+    };
+
+private:
+    struct alignas(64) Queue {
+        mutex lock;
+        deque<Task> tasks;
+    };
+
+    vector<unique_ptr<Queue>> queues;        // [0] = external submitters, [1..] = workers
+    vector<thread> workers;
+    atomic<bool> stopping{false};
+    atomic<int> queued{0};
+    mutex sleepLock;
+    condition_variable wake;
+    atomic<long long> steals{0};
+
+    static inline thread_local WorkStealingPool* ownerPool = nullptr;
+    static inline thread_local int ownerIndex = 0;
+
+    int self() const {
+        return ownerPool == this ? ownerIndex : 0;
+    }
+
+    bool popOwn(int q, Task& out) {
+        Queue& queue = *queues[q];
+        lock_guard<mutex> guard(queue.lock);
+        if(queue.tasks.empty()) return false;
+        out = move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(int thief, Task& out) {
+        int n = queues.size();
+        for(int k = 1; k < n; k++) {
+            Queue& victim = *queues[(thief + k) % n];
+            lock_guard<mutex> guard(victim.lock);
+            if(victim.tasks.empty()) continue;
+            out = move(victim.tasks.front());
+            victim.tasks.pop_front();
+            steals++;
+            return true;
+        }
+        return false;
+    }
+
+    void workerLoop(int index) {
+        ownerPool = this;
+        ownerIndex = index;
+        while(!stopping) {
+            if(runOne()) continue;
+            unique_lock<mutex> lk(sleepLock);
+            wake.wait(lk, [this]() { return stopping || queued > 0; });
+        }
+    }
+
+public:
+    // 'threads' = total parallelism including the thread that calls wait()
+    explicit WorkStealingPool(int threads) {
+        threads = max(1, threads);
+        for(int i = 0; i < threads; i++) queues.push_back(make_unique<Queue>());
+        for(int i = 1; i < threads; i++) workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+
+    ~WorkStealingPool() {
+        {
+            lock_guard<mutex> guard(sleepLock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for(auto& t : workers) t.join();
+    }
+
+    void submit(Task task) {
+        Queue& queue = *queues[self()];
+        {
+            lock_guard<mutex> guard(queue.lock);
+            queue.tasks.push_back(move(task));
+        }
+        {
+            lock_guard<mutex> guard(sleepLock);
+            queued++;
+        }
+        wake.notify_one();
+    }
+
+    // Runs one pending task (own deque first, then steal); false if nothing was runnable
+    bool runOne() {
+        Task task;
+        int q = self();
+        if(!popOwn(q, task) && !steal(q, task)) return false;
+        queued--;
+        task();
+        return true;
+    }
+
+    int threads() const { return queues.size(); }
+    long long stealCount() const { return steals; }
+
+    // body(lo, hi) over [begin, end) in pieces of at most 'grain'; halves are forked so
+    // thieves take large ranges first
+    void parallelFor(int begin, int end, int grain, const function<void(int, int)>& body) {
+        grain = max(1, grain);
+        if(end - begin <= grain || threads() == 1) {
+            if(begin < end) body(begin, end);
+            return;
+        }
+
+        TaskGroup group(*this);
+        function<void(int, int)> split = [&](int lo, int hi) {
+            while(hi - lo > grain) {
+                int mid = lo + (hi - lo) / 2;
+                group.run([&split, mid, hi]() { split(mid, hi); });
+                hi = mid;
+            }
+            body(lo, hi);
+        };
+        split(begin, end);
+        group.wait();
+    }
+
+    // Deterministic reduction: chunk results are combined left to right
+    template<class T, class MapFn, class CombineFn>
+    T parallelReduce(int begin, int end, int grain, T identity, MapFn map, CombineFn combine) {
+        grain = max(1, grain);
+        int chunks = max(0, (end - begin + grain - 1) / grain);
+        vector<T> partial(chunks, identity);
+        parallelFor(0, chunks, 1, [&](int lo, int hi) {
+            for(int c = lo; c < hi; c++) {
+                int from = begin + c * grain;
+                partial[c] = map(from, min(end, from + grain));
+            }
+        });
+
+        T total = identity;
+        for(const T& p : partial) total = combine(total, p);
+        return total;
+    }
+};
+
+// One pool for the whole planner, sized to the machine
+static WorkStealingPool& plannerPool() {
+    static WorkStealingPool pool(max(1u, thread::hardware_concurrency()));
+    return pool;
+}
+
+/**********************************************************************************************
+PARALLEL FLOYD-WARSHALL — for a fixed k, row k does not change and rows are independent,
+so each k step is one parallel loop over rows (hop may be null when paths are not needed)
+**********************************************************************************************/
+static void parallelFloydWarshall(vector<int>& d, int n, NextHopMatrix* hop, WorkStealingPool& pool) {
+    int grain = max(1, 4096 / max(1, n));      // ~4K cell updates per task
+    for(int k = 0; k < n; k++) {
+        const int* rowK = &d[(size_t)k * n];
+        pool.parallelFor(0, n, grain, [&](int lo, int hi) {
+            for(int i = lo; i < hi; i++) {
+                int* rowI = &d[(size_t)i * n];
+                int ik = rowI[k];
+                if(ik == INF) continue;
+                for(int j = 0; j < n; j++) {
+                    if(rowK[j] != INF && ik + rowK[j] < rowI[j]) {
+                        rowI[j] = ik + rowK[j];
+                        if(hop) hop->set(i, j, hop->get(i, k));
+                    }
+                }
+            }
+        });
+    }
+}
+
+/**********************************************************************************************
+DIRECTION-OPTIMIZING MULTI-SOURCE BFS — BITMAP FRONTIERS, PARALLEL LEVEL EXPANSION
+Top-down steps push from the frontier list and claim nodes with an atomic OR on the visited
+bitmap. Once the frontier's edges outweigh the unexplored ones, bottom-up steps let every
+unvisited node look for any frontier neighbour instead; each task owns whole 64-node words,
+so no atomics are needed there. Roads are two-way, so a node's neighbours are also the
+nodes that can reach it. All origins start at level 0 together, and nothing but 'level' is
+written.
+**********************************************************************************************/
+struct BfsStats {
+    int levels = 0;
+    int topDownSteps = 0;
+    int bottomUpSteps = 0;
+};
+
+static BfsStats multiSourceBfs(const vector<vector<Edge>>& adj, const vector<int>& sources, int* level,
+                               WorkStealingPool& pool) {
+    static constexpr int ALPHA = 14;   // go bottom-up when frontier edges > unexplored / ALPHA
+    static constexpr int BETA = 24;    // back to top-down when the frontier < n / BETA nodes
+
+    BfsStats stats;
+    int n = adj.size();
+    int words = (n + 63) / 64;
+    fill(level, level + n, -1);
+    if(n == 0) return stats;
+
+    ArenaScope scope;
+    pmr::memory_resource* mem = scratchResource();
+    pmr::vector<uint64_t> visited(words, 0, mem), frontier(words, 0, mem), next(words, 0, mem);
+    pmr::vector<int> queue(mem);
+    queue.reserve(n);
+    if(n % 64) visited[words - 1] = ~uint64_t(0) << (n % 64);   // padding bits count as seen
+
+    long long unexploredArcs = 0;
+    for(auto& edges : adj) unexploredArcs += edges.size();
+
+    for(int s : sources) {
+        if(s < 0 || s >= n || level[s] == 0) continue;
+        level[s] = 0;
+        visited[s >> 6] |= uint64_t(1) << (s & 63);
+        frontier[s >> 6] |= uint64_t(1) << (s & 63);
+    }
+
+    bool bottomUp = false;
+    for(int depth = 1; ; depth++) {
+        queue.clear();
+        long long frontierArcs = 0;
+        for(int w = 0; w < words; w++) {
+            for(uint64_t bits = frontier[w]; bits; bits &= bits - 1) {
+                int v = w * 64 + __builtin_ctzll(bits);
+                queue.push_back(v);
+                frontierArcs += adj[v].size();
+            }
+        }
+        if(queue.empty()) break;
+        stats.levels = depth;
+        unexploredArcs -= frontierArcs;
+
+        if(!bottomUp && frontierArcs > unexploredArcs / ALPHA) bottomUp = true;
+        else if(bottomUp && (int)queue.size() < n / BETA) bottomUp = false;
+
+        fill(next.begin(), next.end(), 0);
+        if(bottomUp) {
+            stats.bottomUpSteps++;
+            auto scanWords = [&](int lo, int hi) {
+                for(int w = lo; w < hi; w++) {
+                    uint64_t found = 0;
+                    for(uint64_t open = ~visited[w]; open; open &= open - 1) {
+                        int b = __builtin_ctzll(open);
+                        int v = w * 64 + b;
+                        for(auto& e : adj[v]) {
+                            if((frontier[e.to >> 6] >> (e.to & 63)) & 1) {
+                                found |= uint64_t(1) << b;
+                                level[v] = depth;
+                                break;
+                            }
+                        }
+                    }
+                    next[w] = found;
+                    visited[w] |= found;
+                }
+            };
+            // Small levels run inline: no task objects, so a steady-state query stays allocation free
+            if(words <= 16 || pool.threads() == 1) scanWords(0, words);
+            else pool.parallelFor(0, words, 16, scanWords);
+        } else {
+            stats.topDownSteps++;
+            auto expand = [&](int lo, int hi) {
+                for(int i = lo; i < hi; i++) {
+                    for(auto& e : adj[queue[i]]) {
+                        int v = e.to;
+                        uint64_t bit = uint64_t(1) << (v & 63);
+                        if(__atomic_load_n(&visited[v >> 6], __ATOMIC_RELAXED) & bit) continue;
+                        if(__atomic_fetch_or(&visited[v >> 6], bit, __ATOMIC_RELAXED) & bit) continue;
+                        level[v] = depth;   // only the thread that set the bit gets here
+                        __atomic_fetch_or(&next[v >> 6], bit, __ATOMIC_RELAXED);
+                    }
+                }
+            };
+            if(queue.size() <= 256 || pool.threads() == 1) expand(0, queue.size());
+            else pool.parallelFor(0, queue.size(), 256, expand);
+        }
+        swap(frontier, next);
+    }
+    return stats;
+}
+
+/**********************************************************************************************
+SORTING ALGORITHMS
+Zones are never moved while sorting: each sort orders 8-byte (key, index) pairs held in the
+thread's scratch arena, then permutes the Zones once, following cycles with one move each.
+quickSort is an introsort (median-of-three / ninther pivots, heapsort fallback, insertion
+sort on small runs); mergeSort is a stable bottom-up merge that ping-pongs between the keys
+and a single buffer, and fans out over the planner pool for large inputs.
+**********************************************************************************************/
+class SortingAlgorithms {
+public:
+    struct SortKey {
+        int key;     // -waste (high waste first) or zone id
+        int index;   // slot the zone came from
+    };
+
+    static constexpr int INSERTION_RUN = 24;
+    static constexpr int PARALLEL_MIN = 1 << 15;   // below this a parallel merge only costs
+
+    // Quick Sort Implementation (introsort; ties keep input order)
+    static void quickSort(vector<Zone>& zones, int low, int high, bool byWaste = true) {
+        int n = high - low + 1;
+        if (n < 2) return;
+
+        ArenaScope scope;
+        pmr::vector<SortKey> keys(scratchResource());
+        buildKeys(zones, low, n, byWaste, keys);
+        introSort(keys.data(), n, 2 * (31 - __builtin_clz(n)));
+        permute(zones, low, keys.data(), n);
+    }
+    
+    // Merge Sort Implementation (stable)
+    static void mergeSort(vector<Zone>& zones, int left, int right, bool byWaste = true) {
+        int n = right - left + 1;
+        if (n < 2) return;
+
+        ArenaScope scope;
+        pmr::vector<SortKey> keys(scratchResource()), buffer(scratchResource());
+        buildKeys(zones, left, n, byWaste, keys);
+        buffer.resize(n);
+
+        WorkStealingPool& pool = plannerPool();
+        if (n >= PARALLEL_MIN && pool.threads() > 1) {
+            parallelStableSort(keys.data(), buffer.data(), n, pool);
+        } else {
+            stableSort(keys.data(), buffer.data(), n);
+        }
+        permute(zones, left, keys.data(), n);
+    }
+
+    // Counting sort on waste (always 0-100), high first: one pass to count, one to place.
+    // Stable, O(N), and the 101 counters stay in L1.
+    static void countingSort(vector<Zone>& zones, int low, int high) {
+        int n = high - low + 1;
+        if (n < 2) return;
+
+        int count[102] = {0};
+        for (int i = 0; i < n; i++) count[101 - wasteLevel(zones[low + i])]++;
+        for (int b = 1; b <= 101; b++) count[b] += count[b - 1];
+
+        ArenaScope scope;
+        pmr::vector<SortKey> keys(n, scratchResource());
+        for (int i = 0; i < n; i++) {
+            int key = 100 - wasteLevel(zones[low + i]);
+            keys[count[key]++] = {key, i};
+        }
+        permute(zones, low, keys.data(), n);
+    }
+
+    // LSD radix sort on non-negative keys, 8 bits per pass (stable). Passes where every key
+    // has the same byte are skipped, so waste-only keys cost a single counting pass and
+    // packed composite keys (waste, then km to the yard) only pay for the bytes they use.
+    static void radixSort(SortKey* a, SortKey* buffer, int n) {
+        int bits = 0;
+        for (int i = 0; i < n; i++) bits |= a[i].key;
+
+        SortKey* src = a;
+        SortKey* dst = buffer;
+        for (int shift = 0; shift < 32 && (bits >> shift) != 0; shift += 8) {
+            int count[257] = {0};
+            for (int i = 0; i < n; i++) count[((src[i].key >> shift) & 0xFF) + 1]++;
+            if (count[((src[0].key >> shift) & 0xFF) + 1] == n) continue;
+            for (int b = 1; b <= 256; b++) count[b] += count[b - 1];
+            for (int i = 0; i < n; i++) dst[count[(src[i].key >> shift) & 0xFF]++] = src[i];
+            swap(src, dst);
+        }
+        if (src != a) copy(src, src + n, a);
+    }
+
+    // Key-only sorts, for callers that already hold (key, index) pairs
+    static void introSort(SortKey* a, int n, int depthLimit) {
+        while (n > INSERTION_RUN) {
+            if (depthLimit-- == 0) {
+                // Pivots keep going bad: finish this range with guaranteed n log n
+                make_heap(a, a + n, before);
+                sort_heap(a, a + n, before);
+                return;
+            }
+
+            int p = partition(a, n);
+            // Recurse into the smaller side, loop on the larger: stack depth stays O(log n)
+            if (p < n - p - 1) {
+                introSort(a, p, depthLimit);
+                a += p + 1;
+                n -= p + 1;
+            } else {
+                introSort(a + p + 1, n - p - 1, depthLimit);
+                n = p;
+            }
+        }
+        insertionSort(a, n);
+    }
+
+    static void stableSort(SortKey* a, SortKey* buffer, int n) {
+        for (int lo = 0; lo < n; lo += INSERTION_RUN)
+            insertionSort(a + lo, min(INSERTION_RUN, n - lo));
+
+        SortKey* src = a;
+        SortKey* dst = buffer;
+        for (int width = INSERTION_RUN; width < n; width *= 2) {
+            for (int lo = 0; lo < n; lo += 2 * width) {
+                int mid = min(lo + width, n), hi = min(lo + 2 * width, n);
+                mergeRuns(src + lo, mid - lo, src + mid, hi - mid, dst + lo);
+            }
+            swap(src, dst);
+        }
+        if (src != a) copy(src, src + n, a);
+    }
+
+private:
+    // Strict order used by introsort and the heap fallback; the index tiebreak makes the
+    // result identical to a stable sort
+    static bool before(const SortKey& x, const SortKey& y) {
+        return x.key < y.key || (x.key == y.key && x.index < y.index);
+    }
+
+    static int wasteLevel(const Zone& z) {
+        return min(100, max(0, z.currentWaste));
+    }
+
+    static void buildKeys(const vector<Zone>& zones, int first, int n, bool byWaste,
+                          pmr::vector<SortKey>& keys) {
+        keys.resize(n);
+        for (int i = 0; i < n; i++) {
+            const Zone& z = zones[first + i];
+            keys[i] = {byWaste ? -z.currentWaste : z.id, i};
+        }
+    }
+
+    static void insertionSort(SortKey* a, int n) {
+        for (int i = 1; i < n; i++) {
+            SortKey x = a[i];
+            int j = i - 1;
+            while (j >= 0 && before(x, a[j])) {
+                a[j + 1] = a[j];
+                j--;
+            }
+            a[j + 1] = x;
+        }
+    }
+
+    static int medianOfThree(const SortKey* a, int i, int j, int k) {
+        if (before(a[j], a[i])) swap(i, j);
+        if (before(a[k], a[j])) {
+            j = k;
+            if (before(a[j], a[i])) j = i;
+        }
+        return j;
+    }
+
+    // Hoare-style partition around a median-of-three (ninther on big ranges); returns the
+    // pivot's final slot. Already sorted or reversed input splits evenly.
+    static int partition(SortKey* a, int n) {
+        int m;
+        if (n > 128) {
+            int s = n / 8;
+            m = medianOfThree(a, medianOfThree(a, 0, s, 2 * s),
+                              medianOfThree(a, 3 * s, n / 2, 5 * s),
+                              medianOfThree(a, 6 * s, 7 * s, n - 1));
+        } else {
+            m = medianOfThree(a, 0, n / 2, n - 1);
+        }
+        swap(a[0], a[m]);
+        SortKey pivot = a[0];
+
+        int i = 0, j = n;
+        while (true) {
+            do { i++; } while (i < n && before(a[i], pivot));
+            do { j--; } while (before(pivot, a[j]));
+            if (i >= j) break;
+            swap(a[i], a[j]);
+        }
+        swap(a[0], a[j]);
+        return j;
+    }
+
+    // Stable merge: on equal keys the left run wins
+    static void mergeRuns(const SortKey* x, int nx, const SortKey* y, int ny, SortKey* out) {
+        int i = 0, j = 0;
+        while (i < nx && j < ny) {
+            if (y[j].key < x[i].key) *out++ = y[j++];
+            else *out++ = x[i++];
+        }
+        out = copy(x + i, x + nx, out);
+        copy(y + j, y + ny, out);
+    }
+
+    // How many of the first k merged outputs come from x (merge-path split point)
+    static int coRank(int k, const SortKey* x, int nx, const SortKey* y, int ny) {
+        int lo = max(0, k - ny), hi = min(k, nx);
+        while (lo < hi) {
+            int i = (lo + hi) / 2, j = k - i;
+            if (j > 0 && x[i].key <= y[j - 1].key) lo = i + 1;
+            else hi = i;
+        }
+        return lo;
+    }
+
+    // Runs are sorted in parallel, then every merge pass is cut into equal output slices
+    // located by binary search, so the last passes (one or two huge runs) still use all workers
+    static void parallelStableSort(SortKey* a, SortKey* buffer, int n, WorkStealingPool& pool) {
+        int slices = pool.threads() * 4;
+        int run = (n + slices - 1) / slices;
+        pool.parallelFor(0, slices, 1, [&](int lo, int hi) {
+            for (int s = lo; s < hi; s++) {
+                int from = min(n, s * run), to = min(n, from + run);
+                stableSort(a + from, buffer + from, to - from);
+            }
+        });
+
+        SortKey* src = a;
+        SortKey* dst = buffer;
+        int sliceSize = (n + slices - 1) / slices;
+        for (int width = run; width < n; width *= 2) {
+            pool.parallelFor(0, slices, 1, [&](int lo, int hi) {
+                for (int s = lo; s < hi; s++) {
+                    int outLo = min(n, s * sliceSize), outHi = min(n, outLo + sliceSize);
+                    // A slice may straddle several pairs of runs; merge each piece separately
+                    while (outLo < outHi) {
+                        int pairLo = outLo / (2 * width) * (2 * width);
+                        int mid = min(pairLo + width, n), pairHi = min(pairLo + 2 * width, n);
+                        int pieceHi = min(outHi, pairHi);
+                        const SortKey* x = src + pairLo;
+                        const SortKey* y = src + mid;
+                        int nx = mid - pairLo, ny = pairHi - mid;
+                        int i0 = coRank(outLo - pairLo, x, nx, y, ny);
+                        int i1 = coRank(pieceHi - pairLo, x, nx, y, ny);
+                        int j0 = outLo - pairLo - i0, j1 = pieceHi - pairLo - i1;
+                        mergeRuns(x + i0, i1 - i0, y + j0, j1 - j0, dst + outLo);
+                        outLo = pieceHi;
+                    }
+                }
+            });
+            swap(src, dst);
+        }
+        if (src != a) {
+            pool.parallelFor(0, n, 1 << 16, [&](int lo, int hi) {
+                copy(src + lo, src + hi, a + lo);
+            });
+        }
+    }
+
+    // zones[first + i] <- old zones[first + keys[i].index], one move per zone
+    static void permute(vector<Zone>& zones, int first, SortKey* keys, int n) {
+        for (int start = 0; start < n; start++) {
+            if (keys[start].index == start) continue;
+            Zone carried = move(zones[first + start]);
+            int slot = start;
+            while (keys[slot].index != start) {
+                int from = keys[slot].index;
+                zones[first + slot] = move(zones[first + from]);
+                keys[slot].index = slot;   // settled
+                slot = from;
+            }
+            zones[first + slot] = move(carried);
+            keys[slot].index = slot;
+        }
+    }
+};
+
+/**********************************************************************************************
+EXACT TSP SOLVER — HELD-KARP BITMASK DP AND BRANCH & BOUND (OPEN PATH FROM A FIXED START)
+**********************************************************************************************/
+class ExactTspSolver {
+public:
+    static const int HELD_KARP_LIMIT = 18;   // targets; dp table is 2^k * k ints
+
+    struct Result {
+        vector<int> order;        // indices into the cost matrix, order[0] == 0 (the start)
+        int cost;
+        bool optimal;
+        long long nodesExplored;
+
+        Result() : cost(INF), optimal(false), nodesExplored(0) {}
+    };
+
+    // cost is (k+1) x (k+1); index 0 is the start, 1..k are the stops to visit
+    static Result solve(const vector<vector<int>>& cost, WorkStealingPool& pool, double timeLimitSec) {
+        int k = (int)cost.size() - 1;
+        if(k <= HELD_KARP_LIMIT) return heldKarp(cost, pool);
+        return branchAndBound(cost, timeLimitSec);
+    }
+
+    /******************************************************************************************
+    HELD-KARP — dp[mask][j] = cheapest path from the start through 'mask' ending at stop j.
+    Masks of one popcount depend only on the previous layer, so each layer is one
+    parallel loop on the pool.
+    ******************************************************************************************/
+    static Result heldKarp(const vector<vector<int>>& cost, WorkStealingPool& pool) {
+        Result res;
+        int k = (int)cost.size() - 1;
+        res.order.push_back(0);
+        if(k <= 0) {
+            res.cost = 0;
+            res.optimal = true;
+            return res;
+        }
+
+        size_t full = (size_t(1) << k);
+        vector<int> dp(full * k, INF);
+        vector<int8_t> parent(full * k, -1);
+
+        for(int j = 0; j < k; j++) dp[(size_t(1) << j) * k + j] = cost[0][j + 1];
+
+        // Flat copy of the stop-to-stop costs for the inner loop
+        vector<int> c((size_t)k * k);
+        for(int i = 0; i < k; i++)
+            for(int j = 0; j < k; j++)
+                c[(size_t)i * k + j] = cost[i + 1][j + 1];
+
+        vector<vector<uint32_t>> layers(k + 1);
+        for(uint32_t mask = 1; mask < full; mask++) layers[__builtin_popcount(mask)].push_back(mask);
+
+        auto relaxRange = [&](const vector<uint32_t>& layer, size_t from, size_t to) {
+            for(size_t idx = from; idx < to; idx++) {
+                uint32_t mask = layer[idx];
+                int* row = &dp[(size_t)mask * k];
+                int8_t* par = &parent[(size_t)mask * k];
+
+                for(uint32_t bits = mask; bits; bits &= bits - 1) {
+                    int j = __builtin_ctz(bits);
+                    uint32_t prev = mask ^ (1u << j);
+                    const int* prevRow = &dp[(size_t)prev * k];
+                    int best = INF, arg = -1;
+
+                    for(uint32_t pb = prev; pb; pb &= pb - 1) {
+                        int i = __builtin_ctz(pb);
+                        if(prevRow[i] == INF || c[(size_t)i * k + j] == INF) continue;
+                        int cand = prevRow[i] + c[(size_t)i * k + j];
+                        if(cand < best) {
+                            best = cand;
+                            arg = i;
+                        }
+                    }
+                    row[j] = best;
+                    par[j] = (int8_t)arg;
+                }
+            }
+        };
+
+        for(int p = 2; p <= k; p++) {
+            const vector<uint32_t>& layer = layers[p];
+            pool.parallelFor(0, layer.size(), 1024, [&](int lo, int hi) {
+                relaxRange(layer, lo, hi);
+            });
+        }
+
+        uint32_t mask = (uint32_t)(full - 1);
+        int last = -1;
+        for(int j = 0; j < k; j++) {
+            if(dp[(size_t)mask * k + j] < res.cost) {
+                res.cost = dp[(size_t)mask * k + j];
+                last = j;
+            }
+        }
+        if(last == -1) return res;
+
+        vector<int> reversed;
+        while(last != -1) {
+            reversed.push_back(last + 1);
+            int prev = parent[(size_t)mask * k + last];
+            mask ^= (1u << last);
+            last = prev;
+        }
+        res.order.insert(res.order.end(), reversed.rbegin(), reversed.rend());
+        res.optimal = true;
+        res.nodesExplored = (long long)full * k;
+        return res;
+    }
+
+    /******************************************************************************************
+    BRANCH & BOUND — DFS seeded with the nearest neighbour path, pruned by a 1-tree style
+    bound: MST over the unvisited stops plus the cheapest edge from the current stop.
+    ******************************************************************************************/
+    static Result branchAndBound(const vector<vector<int>>& cost, double timeLimitSec) {
+        Result res;
+        int m = cost.size();
+        auto deadline = chrono::steady_clock::now() + chrono::duration<double>(timeLimitSec);
+
+        // Incumbent: nearest neighbour
+        vector<bool> used(m, false);
+        vector<int> path = {0};
+        used[0] = true;
+        int total = 0;
+        for(int step = 1; step < m; step++) {
+            int cur = path.back(), nxt = -1;
+            for(int j = 1; j < m; j++)
+                if(!used[j] && (nxt == -1 || cost[cur][j] < cost[cur][nxt])) nxt = j;
+            if(cost[cur][nxt] == INF) {
+                total = INF;
+                break;
+            }
+            total += cost[cur][nxt];
+            used[nxt] = true;
+            path.push_back(nxt);
+        }
+        if(total < INF) {
+            res.order = path;
+            res.cost = total;
+        }
+
+        vector<int> current = {0};
+        vector<bool> visited(m, false);
+        visited[0] = true;
+        vector<int> key(m);
+        vector<bool> inTree(m);
+        bool timedOut = false;
+
+        auto lowerBound = [&](int at) {
+            // Prim over unvisited stops, then connect 'at' with its cheapest edge
+            int bound = 0, first = -1, link = INF;
+            for(int v = 1; v < m; v++) {
+                inTree[v] = false;
+                key[v] = INF;
+                if(!visited[v]) {
+                    if(first == -1) first = v;
+                    link = min(link, cost[at][v]);
+                }
+            }
+            if(first == -1) return 0;
+            key[first] = 0;
+
+            while(true) {
+                int u = -1;
+                for(int v = 1; v < m; v++)
+                    if(!visited[v] && !inTree[v] && (u == -1 || key[v] < key[u])) u = v;
+                if(u == -1) break;
+                if(key[u] == INF) return INF;
+                inTree[u] = true;
+                bound += key[u];
+                for(int v = 1; v < m; v++)
+                    if(!visited[v] && !inTree[v] && cost[u][v] < key[v]) key[v] = cost[u][v];
+            }
+            return link == INF ? INF : bound + link;
+        };
+
+        function<void(int)> dfs = [&](int soFar) {
+            if(timedOut) return;
+            res.nodesExplored++;
+            if((res.nodesExplored & 1023) == 0 && chrono::steady_clock::now() > deadline) {
+                timedOut = true;
+                return;
+            }
+
+            int at = current.back();
+            if((int)current.size() == m) {
+                if(soFar < res.cost) {
+                    res.cost = soFar;
+                    res.order = current;
+                }
+                return;
+            }
+
+            int lb = lowerBound(at);
+            if(lb == INF || soFar + lb >= res.cost) return;
+
+            vector<int> children;
+            for(int v = 1; v < m; v++)
+                if(!visited[v] && cost[at][v] != INF) children.push_back(v);
+            sort(children.begin(), children.end(), [&](int a, int b) {
+                return cost[at][a] < cost[at][b];
+            });
+
+            for(int v : children) {
+                if(soFar + cost[at][v] >= res.cost) continue;
+                visited[v] = true;
+                current.push_back(v);
+                dfs(soFar + cost[at][v]);
+                current.pop_back();
+                visited[v] = false;
+            }
+        };
+
+        dfs(0);
+        res.optimal = !timedOut && res.cost < INF;
+        return res;
+    }
+};
+
+/**********************************************************************************************
+ROUTE EVALUATOR — PREFIX SUMS OF DISTANCE / LOAD / TIME ALONG A ROUTE, O(1) MOVE DELTAS
+**********************************************************************************************/
+class RouteEvaluator {
+private:
+    const vector<Zone>& zones;
+    const DistanceMatrix& d;
+    vector<int> seq;
+    vector<long long> fwd;       // fwd[i]  = km from seq[0] to seq[i]
+    vector<long long> rev;       // rev[i]  = same legs driven backwards (asymmetric-safe reversal)
+    vector<long long> load;      // load[i] = waste picked up at seq[0..i]
+    vector<long long> clock;     // clock[i] = minutes until service at seq[i] is finished
+
+    // Rebuilds prefix arrays from position 'from' onwards
+    void rebuild(int from) {
+        int n = seq.size();
+        fwd.resize(n);
+        rev.resize(n);
+        load.resize(n);
+        clock.resize(n);
+        for(int i = max(from, 0); i < n; i++) {
+            if(i == 0) {
+                fwd[0] = rev[0] = 0;
+                load[0] = zones[seq[0]].currentWaste;
+                clock[0] = 0;                       // the truck starts here, nothing to service
+                continue;
+            }
+            fwd[i] = fwd[i-1] + leg(seq[i-1], seq[i]);
+            rev[i] = rev[i-1] + leg(seq[i], seq[i-1]);
+            load[i] = load[i-1] + zones[seq[i]].currentWaste;
+            clock[i] = clock[i-1] + leg(seq[i-1], seq[i]) * MINUTES_PER_KM + zones[seq[i]].serviceTime;
+        }
+    }
+
+    long long leg(int a, int b) const {
+        return d.at(a, b);      // INF legs stay huge so deltas through them are never chosen
+    }
+
+    auto legFn() const {
+        return [this](int a, int b) { return leg(a, b); };
+    }
+
+public:
+    RouteEvaluator(const vector<Zone>& zoneList, const DistanceMatrix& distances)
+        : zones(zoneList), d(distances) {}
+
+    void assign(const vector<int>& path) {
+        seq = path;
+        rebuild(0);
+    }
+
+    const vector<int>& path() const { return seq; }
+    int size() const { return seq.size(); }
+
+    static double fuelCost(long long km) {
+        return (km / TRUCK_MILEAGE) * FUEL_PRICE;
+    }
+
+    /******************************************************************************************
+    TOTALS AND SEGMENT QUERIES (ALL O(1))
+    ******************************************************************************************/
+    int distance() const { return seq.empty() ? 0 : (int)min<long long>(fwd.back(), INF); }
+    double cost() const { return fuelCost(distance()); }
+    int waste() const { return seq.empty() ? 0 : (int)load.back(); }
+    int minutes() const { return seq.empty() ? 0 : (int)clock.back(); }
+
+    // Km driven between positions i <= j, and waste collected at positions i..j
+    long long segmentDistance(int i, int j) const { return fwd[j] - fwd[i]; }
+    long long segmentLoad(int i, int j) const { return load[j] - (i ? load[i-1] : 0); }
+    long long finishedAt(int i) const { return clock[i]; }
+
+    Route toRoute() const {
+        Route r;
+        r.path = seq;
+        r.totalDistance = distance();
+        r.totalCost = cost();
+        r.totalWaste = waste();
+        return r;
+    }
+
+    /******************************************************************************************
+    ENDPOINT MOVE COSTS — change in km from the legs at the ends of a segment only, for any
+    leg function cost(a, b). next / after == -1 means the segment ends the route. These are
+    what the local searches (TourImprover, TimeWindowSchedule) price their moves with, so
+    they keep their own tour arrays but share the arithmetic with the evaluator.
+    ******************************************************************************************/
+    // Segment first..last taken out from between prev and next
+    template<class Leg>
+    static long long detachCost(const Leg& cost, int prev, int first, int last, int next) {
+        long long delta = -(long long)cost(prev, first);
+        if(next != -1) delta += (long long)cost(prev, next) - cost(last, next);
+        return delta;
+    }
+
+    // Segment left..right put in between before and after
+    template<class Leg>
+    static long long attachCost(const Leg& cost, int before, int left, int right, int after) {
+        long long delta = cost(before, left);
+        if(after != -1) delta += (long long)cost(right, after) - cost(before, after);
+        return delta;
+    }
+
+    // Segment first..last reversed in place; inner legs are taken as unchanged (symmetric)
+    template<class Leg>
+    static long long reversalCost(const Leg& cost, int prev, int first, int last, int next) {
+        long long delta = (long long)cost(prev, last) - cost(prev, first);
+        if(next != -1) delta += (long long)cost(first, next) - cost(last, next);
+        return delta;
+    }
+
+    /******************************************************************************************
+    MOVE DELTAS — change in km if the move were applied (negative = shorter). Position 0 is
+    the fixed start and is never moved.
+    ******************************************************************************************/
+    // Insert 'zone' so it ends up at position pos (1 <= pos <= size)
+    long long insertDelta(int pos, int zone) const {
+        return attachCost(legFn(), seq[pos-1], zone, zone, pos < size() ? seq[pos] : -1);
+    }
+
+    // Remove the stop at pos (1 <= pos < size)
+    long long removeDelta(int pos) const {
+        return detachCost(legFn(), seq[pos-1], seq[pos], seq[pos], pos + 1 < size() ? seq[pos+1] : -1);
+    }
+
+    // Exchange the stops at positions i < j (both >= 1)
+    long long swapDelta(int i, int j) const {
+        if(i > j) swap(i, j);
+        if(i == j) return 0;
+        int n = size();
+        long long before = leg(seq[i-1], seq[i]) + (j + 1 < n ? leg(seq[j], seq[j+1]) : 0);
+        long long after = leg(seq[i-1], seq[j]) + (j + 1 < n ? leg(seq[i], seq[j+1]) : 0);
+        if(j == i + 1) {
+            before += leg(seq[i], seq[j]);
+            after += leg(seq[j], seq[i]);
+        } else {
+            before += leg(seq[i], seq[i+1]) + leg(seq[j-1], seq[j]);
+            after += leg(seq[j], seq[i+1]) + leg(seq[j-1], seq[i]);
+        }
+        return after - before;
+    }
+
+    // Reverse positions i..j (1 <= i < j < size); inner legs come from the reverse prefix
+    long long reverseDelta(int i, int j) const {
+        int n = size();
+        long long before = leg(seq[i-1], seq[i]) + (fwd[j] - fwd[i]);
+        long long after = leg(seq[i-1], seq[j]) + (rev[j] - rev[i]);
+        if(j + 1 < n) {
+            before += leg(seq[j], seq[j+1]);
+            after += leg(seq[i], seq[j+1]);
+        }
+        return after - before;
+    }
+
+    /******************************************************************************************
+    LOAD AND TIME DELTAS — change in waste carried and in minutes on the road + servicing.
+    Swaps and reversals keep the same stops, so their load delta is always 0.
+    ******************************************************************************************/
+    long long insertLoadDelta(int zone) const { return zones[zone].currentWaste; }
+    long long removeLoadDelta(int pos) const { return -(long long)zones[seq[pos]].currentWaste; }
+
+    // Would inserting 'zone' keep the route within 'capacity'?
+    bool fitsAfterInsert(int zone, long long capacity) const {
+        return waste() + insertLoadDelta(zone) <= capacity;
+    }
+
+    long long insertMinutesDelta(int pos, int zone) const {
+        return insertDelta(pos, zone) * MINUTES_PER_KM + zones[zone].serviceTime;
+    }
+
+    long long removeMinutesDelta(int pos) const {
+        return removeDelta(pos) * MINUTES_PER_KM - zones[seq[pos]].serviceTime;
+    }
+
+    long long swapMinutesDelta(int i, int j) const { return swapDelta(i, j) * MINUTES_PER_KM; }
+    long long reverseMinutesDelta(int i, int j) const { return reverseDelta(i, j) * MINUTES_PER_KM; }
+
+    /******************************************************************************************
+    APPLY MOVES — O(n) suffix rebuild
+    ******************************************************************************************/
+    void insert(int pos, int zone) {
+        seq.insert(seq.begin() + pos, zone);
+        rebuild(pos);
+    }
+
+    void removeAt(int pos) {
+        seq.erase(seq.begin() + pos);
+        rebuild(pos);
+    }
+
+    void swapStops(int i, int j) {
+        swap(seq[i], seq[j]);
+        rebuild(min(i, j));
+    }
+
+    void reverse(int i, int j) {
+        std::reverse(seq.begin() + i, seq.begin() + j + 1);
+        rebuild(i);
+    }
+};
+
+/**********************************************************************************************
+TOUR IMPROVEMENT ENGINE — CANDIDATE-LIST 2-OPT / OR-OPT LOCAL SEARCH WITH DOUBLE-BRIDGE KICKS
+(LIN-KERNIGHAN STYLE ITERATED LOCAL SEARCH, OPEN PATH WITH A FIXED START, ANYTIME)
+**********************************************************************************************/
+class TourImprover {
+public:
+    struct Result {
+        vector<int> tour;        // stop indices, tour[0] is the fixed start
+        int cost;
+        int lowerBound;          // Held-Karp 1-tree bound (0 when not computed)
+        int kicks;
+        int improvements;
+
+        Result() : cost(INF), lowerBound(0), kicks(0), improvements(0) {}
+    };
+
+    static const int CANDIDATES = 8;
+
+private:
+    const DistanceMatrix& d;          // road distance matrix over zone ids
+    const vector<int>& stops;         // stop index -> zone id
+    int m;
+    vector<int> tour, pos;
+    vector<vector<int>> cand;
+    vector<char> dontLook;
+    vector<int> active;
+    mt19937 rng;
+
+    int c(int a, int b) const {
+        return d.at(stops[a], stops[b]);
+    }
+
+    int pathCost(const vector<int>& t) const {
+        long long total = 0;
+        for(int i = 1; i < (int)t.size(); i++) total += c(t[i-1], t[i]);
+        return (int)min<long long>(total, INF);
+    }
+
+    void buildCandidates() {
+        cand.assign(m, {});
+        vector<int> order(m);
+        for(int a = 0; a < m; a++) {
+            iota(order.begin(), order.end(), 0);
+            int k = min(CANDIDATES + 1, m);
+            partial_sort(order.begin(), order.begin() + k, order.end(), [&](int x, int y) {
+                return c(a, x) < c(a, y);
+            });
+            for(int i = 0; i < k; i++)
+                if(order[i] != a && c(a, order[i]) != INF) cand[a].push_back(order[i]);
+        }
+    }
+
+    void activate(int node) {
+        if(dontLook[node]) {
+            dontLook[node] = 0;
+            active.push_back(node);
+        }
+    }
+
+    void reverseSegment(int i, int j) {
+        while(i < j) {
+            swap(tour[i], tour[j]);
+            pos[tour[i]] = i;
+            pos[tour[j]] = j;
+            i++;
+            j--;
+        }
+    }
+
+    auto legFn() const {
+        return [this](int a, int b) { return c(a, b); };
+    }
+
+    // Gain of reversing positions [i..j] (1 <= i < j <= m-1), positive = shorter
+    long long twoOptGain(int i, int j) const {
+        return -RouteEvaluator::reversalCost(legFn(), tour[i-1], tour[i], tour[j], j + 1 < m ? tour[j+1] : -1);
+    }
+
+    bool tryTwoOpt(int a) {
+        int p = pos[a];
+        for(int b : cand[a]) {
+            int q = pos[b];
+            int i = -1, j = -1;
+
+            // New edge (a, b) replacing the edge after a ...
+            if(p + 1 < m && c(a, b) < c(a, tour[p+1])) {
+                if(q > p) { i = p + 1; j = q; }
+                else { i = q + 1; j = p; }       // q == 0 reverses [1..p] onto the start
+            }
+            if(i != -1 && i < j && twoOptGain(i, j) > 0) {
+                reverseSegment(i, j);
+                activate(a); activate(b);
+                activate(tour[i]); activate(tour[j]);
+                return true;
+            }
+
+            // ... or the edge before a (b at the fixed start is covered above: joining it
+            // to a here would need the start itself inside the reversed segment)
+            i = j = -1;
+            if(p >= 1 && c(a, b) < c(tour[p-1], a)) {
+                if(q < p && q >= 1) { i = q; j = p - 1; }
+                else if(q > p) { i = p; j = q - 1; }
+            }
+            if(i != -1 && i < j && twoOptGain(i, j) > 0) {
+                reverseSegment(i, j);
+                activate(a); activate(b);
+                activate(tour[i]); activate(tour[j]);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Moves the segment [i..i+len-1] so that it follows position g (reversed if asked)
+    void moveSegment(int i, int len, int g, bool reversed) {
+        vector<int> seg(tour.begin() + i, tour.begin() + i + len);
+        if(reversed) reverse(seg.begin(), seg.end());
+        if(g < i) {
+            // shift (g+1 .. i-1) right by len
+            for(int k = i - 1; k > g; k--) tour[k + len] = tour[k];
+            for(int k = 0; k < len; k++) tour[g + 1 + k] = seg[k];
+            for(int k = g + 1; k < i + len; k++) pos[tour[k]] = k;
+        } else {
+            // shift (i+len .. g) left by len
+            for(int k = i + len; k <= g; k++) tour[k - len] = tour[k];
+            for(int k = 0; k < len; k++) tour[g - len + 1 + k] = seg[k];
+            for(int k = i; k <= g; k++) pos[tour[k]] = k;
+        }
+    }
+
+    bool tryOrOpt(int a) {
+        int p = pos[a];
+        for(int len = 1; len <= 3; len++) {
+            for(int start = max(1, p - len + 1); start <= p; start++) {
+                int end = start + len - 1;
+                if(end >= m) break;
+
+                int prev = tour[start-1];
+                int next = (end + 1 < m) ? tour[end+1] : -1;
+                int first = tour[start], last = tour[end];
+                long long removeGain = -RouteEvaluator::detachCost(legFn(), prev, first, last, next);
+
+                for(int endpoint : {first, last}) {
+                    for(int b : cand[endpoint]) {
+                        int q = pos[b];
+                        if(q >= start - 1 && q <= end) continue;
+
+                        // Insert between b and its successor (or after b when b is last)
+                        int after = (q + 1 < m) ? tour[q+1] : -1;
+                        if(after != -1 && pos[after] >= start && pos[after] <= end) continue;
+
+                        for(int rev = 0; rev < 2; rev++) {
+                            int left = rev ? last : first;
+                            int right = rev ? first : last;
+                            long long addCost = RouteEvaluator::attachCost(legFn(), b, left, right, after);
+
+                            if(removeGain - addCost > 0) {
+                                moveSegment(start, len, q, rev == 1);
+                                activate(first); activate(last); activate(prev); activate(b);
+                                if(next != -1) activate(next);
+                                if(after != -1) activate(after);
+                                return true;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    // dontLook[v] == 0 means v is queued; a successful move re-queues its endpoints
+    void localSearch() {
+        while(!active.empty()) {
+            int a = active.back();
+            active.pop_back();
+            dontLook[a] = 1;
+            if(!tryTwoOpt(a)) tryOrOpt(a);
+        }
+    }
+
+    void doubleBridge() {
+        if(m < 8) return;
+        int a = 1 + rng() % (m - 3);
+        int b = 1 + rng() % (m - 3);
+        int e = 1 + rng() % (m - 3);
+        int cuts[3] = {a, b, e};
+        sort(cuts, cuts + 3);
+        if(cuts[0] == cuts[1] || cuts[1] == cuts[2]) return;
+
+        vector<int> next;
+        next.reserve(m);
+        next.insert(next.end(), tour.begin(), tour.begin() + cuts[0]);
+        next.insert(next.end(), tour.begin() + cuts[1], tour.begin() + cuts[2]);
+        next.insert(next.end(), tour.begin() + cuts[0], tour.begin() + cuts[1]);
+        next.insert(next.end(), tour.begin() + cuts[2], tour.end());
+        tour.swap(next);
+        for(int i = 0; i < m; i++) pos[tour[i]] = i;
+
+        for(int cut : cuts) {
+            for(int k = max(0, cut - 2); k <= min(m - 1, cut + 1); k++) activate(tour[k]);
+        }
+    }
+
+public:
+    TourImprover(const DistanceMatrix& distances, const vector<int>& stopZones, unsigned seed = 12345)
+        : d(distances), stops(stopZones), m(stopZones.size()), rng(seed) {}
+
+    /******************************************************************************************
+    ANYTIME IMPROVEMENT — returns the best tour found before the deadline. The callback
+    (optional) is invoked with every new best tour.
+    ******************************************************************************************/
+    Result improve(const vector<int>& initial, double timeLimitSec, int maxKicks,
+                   function<void(const vector<int>&, int)> onImprove = nullptr) {
+        auto deadline = chrono::steady_clock::now() + chrono::duration<double>(timeLimitSec);
+        Result best;
+        tour = initial;
+        best.tour = initial;
+        best.cost = pathCost(initial);
+        if(m < 3) return best;
+
+        pos.assign(m, 0);
+        for(int i = 0; i < m; i++) pos[tour[i]] = i;
+        buildCandidates();
+
+        dontLook.assign(m, 1);
+        active.clear();
+        for(int i = m - 1; i >= 0; i--) activate(tour[i]);
+
+        localSearch();
+        int cost = pathCost(tour);
+        if(cost < best.cost) {
+            best.cost = cost;
+            best.tour = tour;
+            best.improvements++;
+            if(onImprove) onImprove(best.tour, best.cost);
+        }
+
+        while(best.kicks < maxKicks && chrono::steady_clock::now() < deadline) {
+            doubleBridge();
+            localSearch();
+            best.kicks++;
+
+            cost = pathCost(tour);
+            if(cost < best.cost) {
+                best.cost = cost;
+                best.tour = tour;
+                best.improvements++;
+                if(onImprove) onImprove(best.tour, best.cost);
+            } else if(cost > best.cost) {
+                tour = best.tour;
+                for(int i = 0; i < m; i++) pos[tour[i]] = i;
+            }
+        }
+
+        return best;
+    }
+
+    /******************************************************************************************
+    HELD-KARP 1-TREE LOWER BOUND (SUBGRADIENT ASCENT). For an open path from stop 0 the
+    target degree is 1 at the start and 2 elsewhere; one unknown endpoint has degree 1,
+    which is covered by adding back the smallest penalty.
+    ******************************************************************************************/
+    int lowerBound(double timeLimitSec, int maxIterations = 50) {
+        if(m < 2) return 0;
+        auto deadline = chrono::steady_clock::now() + chrono::duration<double>(timeLimitSec);
+
+        vector<double> pi(m, 0.0), key(m);
+        vector<int> parent(m), degree(m);
+        vector<char> inTree(m);
+        double best = 0, step = 0;
+
+        for(int it = 0; it < maxIterations && chrono::steady_clock::now() < deadline; it++) {
+            // Prim over modified costs c(i,j) + pi[i] + pi[j]
+            fill(key.begin(), key.end(), 1e18);
+            fill(inTree.begin(), inTree.end(), 0);
+            fill(degree.begin(), degree.end(), 0);
+            key[0] = 0;
+            parent[0] = -1;
+            double tree = 0;
+
+            for(int round = 0; round < m; round++) {
+                int u = -1;
+                for(int v = 0; v < m; v++)
+                    if(!inTree[v] && (u == -1 || key[v] < key[u])) u = v;
+                if(key[u] >= 1e17) return (int)best;
+                inTree[u] = 1;
+                tree += key[u];
+                if(parent[u] != -1) {
+                    degree[u]++;
+                    degree[parent[u]]++;
+                }
+                for(int v = 0; v < m; v++) {
+                    if(inTree[v]) continue;
+                    double w = c(u, v) + pi[u] + pi[v];
+                    if(w < key[v]) {
+                        key[v] = w;
+                        parent[v] = u;
+                    }
+                }
+            }
+
+            double targetSum = pi[0];
+            double minPi = 1e18;
+            for(int v = 1; v < m; v++) {
+                targetSum += 2 * pi[v];
+                minPi = min(minPi, pi[v]);
+            }
+            double bound = tree - targetSum + minPi;
+            best = max(best, bound);
+
+            if(it == 0) step = max(1.0, tree / m) * 0.5;
+            else step *= 0.92;
+            for(int v = 0; v < m; v++) {
+                int target = (v == 0) ? 1 : 2;
+                pi[v] += step * (degree[v] - target);
+            }
+        }
+
+        return (int)ceil(best - 1e-6);
+    }
+};
+
+/**********************************************************************************************
+PARALLEL MULTI-START ROUTE SEARCH (PORTFOLIO OF RANDOMIZED STARTS + LOCAL SEARCH)
+Workers share the incumbent through an atomically swapped immutable snapshot.
+**********************************************************************************************/
+class ParallelRouteSearch {
+public:
+    struct Incumbent {
+        int cost;
+        vector<int> tour;   // stop indices, tour[0] is the start
+        int foundBy;
+    };
+
+    struct Result {
+        vector<int> tour;
+        int cost;
+        int restarts;
+        int threads;
+
+        Result() : cost(INF), restarts(0), threads(0) {}
+    };
+
+private:
+    const DistanceMatrix& d;
+    const vector<int>& stops;
+    int m;
+
+    shared_ptr<const Incumbent> best;    // accessed only through atomic_load / atomic_compare_exchange
+    atomic<int> restarts;
+
+    // Publishes 'cost/tour' if it beats the incumbent; retries when another worker won the race
+    void offer(int cost, const vector<int>& tour, int worker) {
+        shared_ptr<const Incumbent> current = atomic_load(&best);
+        shared_ptr<const Incumbent> mine;
+
+        while(!current || cost < current->cost) {
+            if(!mine) mine = make_shared<const Incumbent>(Incumbent{cost, tour, worker});
+            if(atomic_compare_exchange_weak(&best, &current, mine)) return;
+        }
+    }
+
+    // Nearest neighbour that picks uniformly among the 3 closest unvisited stops
+    vector<int> randomizedConstruction(mt19937& rng) {
+        vector<int> tour = {0};
+        vector<char> used(m, 0);
+        used[0] = 1;
+
+        for(int step = 1; step < m; step++) {
+            int cur = tour.back();
+            DistanceMatrix::RowView row = d[stops[cur]];
+            int top[3] = {-1, -1, -1};
+            for(int j = 1; j < m; j++) {
+                if(used[j]) continue;
+                int cost = row[stops[j]];
+                for(int k = 0; k < 3; k++) {
+                    if(top[k] == -1 || cost < row[stops[top[k]]]) {
+                        for(int s = 2; s > k; s--) top[s] = top[s-1];
+                        top[k] = j;
+                        break;
+                    }
+                }
+            }
+            int choices = (top[2] != -1) ? 3 : (top[1] != -1) ? 2 : 1;
+            int pick = top[rng() % choices];
+            used[pick] = 1;
+            tour.push_back(pick);
+        }
+        return tour;
+    }
+
+    void worker(int id, chrono::steady_clock::time_point deadline) {
+        mt19937 rng(7919u * (id + 1));
+
+        while(chrono::steady_clock::now() < deadline) {
+            // Half of the restarts intensify around the shared incumbent, half diversify
+            vector<int> initial;
+            shared_ptr<const Incumbent> current = atomic_load(&best);
+            if(current && (rng() & 1)) initial = current->tour;
+            else initial = randomizedConstruction(rng);
+
+            double left = chrono::duration<double>(deadline - chrono::steady_clock::now()).count();
+            if(left <= 0) break;
+
+            TourImprover improver(d, stops, rng());
+            TourImprover::Result res = improver.improve(initial, min(left, 0.25), 10 * m);
+            restarts++;
+            offer(res.cost, res.tour, id);
+        }
+    }
+
+public:
+    ParallelRouteSearch(const DistanceMatrix& distances, const vector<int>& stopZones)
+        : d(distances), stops(stopZones), m(stopZones.size()), restarts(0) {}
+
+    // One restart chain per thread; chains are long-running pool tasks, so more chains than
+    // pool threads would only start after the deadline
+    Result run(int threads, double seconds, WorkStealingPool& pool = plannerPool()) {
+        Result res;
+        threads = max(1, min(threads, pool.threads()));
+        res.threads = threads;
+        atomic_store(&best, shared_ptr<const Incumbent>());
+        restarts = 0;
+
+        if(m == 0) return res;
+        if(m < 3) {
+            res.tour.resize(m);
+            iota(res.tour.begin(), res.tour.end(), 0);
+            res.cost = (m == 2) ? d.at(stops[0], stops[1]) : 0;
+            return res;
+        }
+
+        chrono::steady_clock::time_point deadline = chrono::steady_clock::now() +
+            chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(seconds));
+        WorkStealingPool::TaskGroup group(pool);
+        for(int t = 0; t < threads; t++) group.run([this, t, deadline]() { worker(t, deadline); });
+        group.wait();
+
+        shared_ptr<const Incumbent> winner = atomic_load(&best);
+        if(winner) {
+            res.tour = winner->tour;
+            res.cost = winner->cost;
+        }
+        res.restarts = restarts;
+        return res;
+    }
+};
+
+/**********************************************************************************************
+TIME-WINDOW SCHEDULE — FORWARD START TIMES / BACKWARD LATEST STARTS FOR O(1) INSERTION CHECKS
+Times are minutes after the shift starts (SHIFT_START_HOUR). The route is an open path that
+must finish its last service before the driver's shift cap.
+**********************************************************************************************/
+class TimeWindowSchedule {
+private:
+    const vector<Zone>& zones;
+    const DistanceMatrix& d;
+    vector<int> seq;         // zone ids, seq[0] is the driver's start location
+    vector<int> startAt;     // earliest service start (forward propagation)
+    vector<int> latest;      // latest service start keeping the suffix feasible (backward)
+
+    int travel(int a, int b) const {
+        return d[a][b] == INF ? INF : d[a][b] * MINUTES_PER_KM;
+    }
+
+    int ownLatest(int z) const {
+        return min(zones[z].windowClose, DRIVER_SHIFT_MINUTES - zones[z].serviceTime);
+    }
+
+public:
+    TimeWindowSchedule(const vector<Zone>& zoneList, const DistanceMatrix& distances, int start)
+        : zones(zoneList), d(distances), seq(1, start) {
+        recompute();
+    }
+
+    void recompute() {
+        int n = seq.size();
+        startAt.assign(n, 0);
+        latest.assign(n, DRIVER_SHIFT_MINUTES);
+
+        for(int i = 1; i < n; i++) {
+            int arrive = startAt[i-1] + (i - 1 == 0 ? 0 : zones[seq[i-1]].serviceTime) + travel(seq[i-1], seq[i]);
+            startAt[i] = max(arrive, zones[seq[i]].windowOpen);
+        }
+        for(int i = n - 1; i >= 1; i--) {
+            latest[i] = ownLatest(seq[i]);
+            if(i + 1 < n) {
+                latest[i] = min(latest[i], latest[i+1] - travel(seq[i], seq[i+1]) - zones[seq[i]].serviceTime);
+            }
+        }
+    }
+
+    bool feasible() const {
+        for(int i = 1; i < (int)seq.size(); i++)
+            if(startAt[i] > latest[i]) return false;
+        return true;
+    }
+
+    // Can zone z be served between positions pos and pos+1? O(1) using the cached times
+    bool canInsert(int pos, int z) const {
+        int departPrev = startAt[pos] + (pos == 0 ? 0 : zones[seq[pos]].serviceTime);
+        int leg = travel(seq[pos], z);
+        if(leg == INF) return false;
+
+        int startZ = max(departPrev + leg, zones[z].windowOpen);
+        if(startZ > ownLatest(z)) return false;
+        if(pos + 1 >= (int)seq.size()) return true;
+
+        int legNext = travel(z, seq[pos+1]);
+        if(legNext == INF) return false;
+        int startNext = max(startZ + zones[z].serviceTime + legNext, zones[seq[pos+1]].windowOpen);
+        return startNext <= latest[pos+1];
+    }
+
+    // Extra kilometres caused by inserting z after position pos
+    int insertionCost(int pos, int z) const {
+        auto km = [this](int a, int b) { return d[a][b]; };
+        int after = pos + 1 < (int)seq.size() ? seq[pos+1] : -1;
+        return (int)RouteEvaluator::attachCost(km, seq[pos], z, z, after);
+    }
+
+    void insert(int pos, int z) {
+        seq.insert(seq.begin() + pos + 1, z);
+        recompute();
+    }
+
+    void removeAt(int pos) {
+        seq.erase(seq.begin() + pos);
+        recompute();
+    }
+
+    // Cheapest feasible insertion position for z (-1 if none)
+    int bestInsertion(int z, int& extraKm) const {
+        int best = -1;
+        extraKm = INF;
+        for(int pos = 0; pos < (int)seq.size(); pos++) {
+            if(!canInsert(pos, z)) continue;
+            int cost = insertionCost(pos, z);
+            if(cost < extraKm) {
+                extraKm = cost;
+                best = pos;
+            }
+        }
+        return best;
+    }
+
+    const vector<int>& stops() const { return seq; }
+    int serviceStart(int i) const { return startAt[i]; }
+
+    int totalDistance() const {
+        int total = 0;
+        for(int i = 1; i < (int)seq.size(); i++) total += d[seq[i-1]][seq[i]];
+        return total;
+    }
+
+    int finishTime() const {
+        int n = seq.size();
+        return n <= 1 ? 0 : startAt[n-1] + zones[seq[n-1]].serviceTime;
+    }
+};
+
+/**********************************************************************************************
+PERSISTENT ROUTE STORE — APPEND-ONLY BINARY LOG + IN-MEMORY INDEXES
+Record: [magic u32][payload bytes u32][payload][FNV-1a checksum u32]
+Payload: date i32 (yyyymmdd) | driver len u8 + chars | distance i32 | waste i32 |
+         stop count u32 | zone ids u32...   (fuel cost is derived from distance)
+Records written before "RTE2" ("RTE1") have a u16 stop count and u16 zone ids; both load.
+**********************************************************************************************/
+class RouteStore {
+public:
+    enum Metric { SHORTEST_DISTANCE, LOWEST_COST, MOST_WASTE };
+
+    struct Summary {
+        int date;
+        int driver;             // index into drivers()
+        int start;
+        int distance;
+        double cost;
+        int waste;
+        int stops;
+        uint64_t offset;        // file offset of the record header
+    };
+
+    static constexpr int TOP_K = 5;
+
+private:
+    static const uint32_t RECORD_MAGIC_V1 = 0x52544531;   // "RTE1": 16-bit zone ids
+    static const uint32_t RECORD_MAGIC = 0x52544532;      // "RTE2": 32-bit zone ids
+    static const uint32_t MAX_PAYLOAD = 1u << 26;
+
+    string filename;
+    vector<Summary> records;
+    vector<string> driverNames;
+    unordered_map<string, int> driverId;
+
+    map<int, vector<int>> byDate;                 // ordered, so date ranges are a map walk
+    vector<vector<int>> byDriver;
+    unordered_map<int, vector<int>> byStart;
+    vector<int> top[3];                            // best TOP_K record ids per metric
+    int damaged = 0;                               // corrupt records skipped by open()
+
+    static uint32_t checksum(const string& bytes) {
+        uint32_t h = 2166136261u;
+        for(unsigned char c : bytes) {
+            h ^= c;
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    template<class T> static void put(string& out, T v) {
+        out.append(reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+
+    template<class T> static bool get(const string& in, size_t& at, T& v) {
+        if(at + sizeof(v) > in.size()) return false;
+        memcpy(&v, in.data() + at, sizeof(v));
+        at += sizeof(v);
+        return true;
+    }
+
+    int internDriver(const string& name) {
+        auto it = driverId.find(name);
+        if(it != driverId.end()) return it->second;
+        driverNames.push_back(name);
+        byDriver.push_back({});
+        return driverId[name] = driverNames.size() - 1;
+    }
+
+    // Strictly better, ties keep the older record (matches a first-found linear scan)
+    bool better(Metric m, int a, int b) const {
+        const Summary& x = records[a];
+        const Summary& y = records[b];
+        if(m == SHORTEST_DISTANCE) return x.distance < y.distance;
+        if(m == LOWEST_COST) return x.cost < y.cost;
+        return x.waste > y.waste;
+    }
+
+    void index(const Summary& s) {
+        int rid = records.size();
+        records.push_back(s);
+        byDate[s.date].push_back(rid);
+        byDriver[s.driver].push_back(rid);
+        byStart[s.start].push_back(rid);
+
+        for(int m = 0; m < 3; m++) {
+            vector<int>& t = top[m];
+            int pos = t.size();
+            while(pos > 0 && better((Metric)m, rid, t[pos-1])) pos--;
+            if(pos < TOP_K) {
+                t.insert(t.begin() + pos, rid);
+                if(t.size() > TOP_K) t.pop_back();
+            }
+        }
+    }
+
+    // 'wide': RTE2 record (32-bit stop count and zone ids)
+    bool parse(const string& payload, bool wide, Summary& s, vector<int>* path) {
+        size_t at = 0;
+        uint8_t len = 0;
+        uint32_t count = 0;
+        uint16_t narrowCount = 0;
+        if(!get(payload, at, s.date) || !get(payload, at, len) || at + len > payload.size()) return false;
+        string driver = payload.substr(at, len);
+        at += len;
+        if(!get(payload, at, s.distance) || !get(payload, at, s.waste)) return false;
+        if(wide ? !get(payload, at, count) : !get(payload, at, narrowCount)) return false;
+        if(!wide) count = narrowCount;
+        size_t width = wide ? sizeof(uint32_t) : sizeof(uint16_t);
+        if(count == 0 || (payload.size() - at) / width != count || (payload.size() - at) % width) return false;
+
+        auto zoneAt = [&](size_t i) {
+            uint32_t z = 0;
+            uint16_t narrow = 0;
+            if(wide) memcpy(&z, payload.data() + at + i * width, sizeof(z));
+            else {
+                memcpy(&narrow, payload.data() + at + i * width, sizeof(narrow));
+                z = narrow;
+            }
+            return (int)z;
+        };
+        s.start = zoneAt(0);
+        s.stops = count;
+        s.cost = RouteEvaluator::fuelCost(s.distance);
+        s.driver = internDriver(driver);
+        if(path) {
+            path->resize(count);
+            for(size_t i = 0; i < count; i++) (*path)[i] = zoneAt(i);
+        }
+        return true;
+    }
+
+    bool readRecord(istream& in, string& payload, bool& wide) {
+        uint32_t magic = 0, bytes = 0, sum = 0;
+        in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        in.read(reinterpret_cast<char*>(&bytes), sizeof(bytes));
+        if(!in || (magic != RECORD_MAGIC && magic != RECORD_MAGIC_V1) || bytes > MAX_PAYLOAD) return false;
+        wide = magic == RECORD_MAGIC;
+        payload.resize(bytes);
+        in.read(&payload[0], bytes);
+        in.read(reinterpret_cast<char*>(&sum), sizeof(sum));
+        return bool(in) && sum == checksum(payload);
+    }
+
+    // Reads and indexes the record at 'offset'; on success 'in' is left just past it
+    bool indexAt(istream& in, uint64_t offset) {
+        string payload;
+        bool wide;
+        Summary s;
+        in.clear();
+        in.seekg(offset);
+        if(!readRecord(in, payload, wide) || !parse(payload, wide, s, nullptr)) return false;
+        s.offset = offset;
+        index(s);
+        return true;
+    }
+
+    // Offset of the first record at or after 'from' whose header and checksum are intact,
+    // or 'fileEnd' when there is none
+    uint64_t nextIntactRecord(istream& in, uint64_t from, uint64_t fileEnd) {
+        string rest(fileEnd - from, '\0');
+        in.clear();
+        in.seekg(from);
+        if(!rest.empty()) in.read(&rest[0], rest.size());
+        rest.resize(in.gcount());
+
+        string payload;
+        bool wide;
+        for(size_t at = 0; at + sizeof(uint32_t) <= rest.size(); at++) {
+            uint32_t magic;
+            memcpy(&magic, rest.data() + at, sizeof(magic));
+            if(magic != RECORD_MAGIC && magic != RECORD_MAGIC_V1) continue;
+            in.clear();
+            in.seekg(from + at);
+            if(readRecord(in, payload, wide)) return from + at;
+        }
+        return fileEnd;
+    }
+
+public:
+    // Loads the index from an existing log. A torn tail (crash mid-append) is cut off in place;
+    // a damaged record with intact ones after it is skipped and counted in damagedRecords().
+    void open(const string& file) {
+        filename = file;
+        records.clear();
+        driverNames.clear();
+        driverId.clear();
+        byDate.clear();
+        byDriver.clear();
+        byStart.clear();
+        for(auto& t : top) t.clear();
+        damaged = 0;
+
+        ifstream in(filename, ios::binary);
+        if(!in) return;
+        in.seekg(0, ios::end);
+        uint64_t fileEnd = in.tellg();
+
+        uint64_t offset = 0, validEnd = 0;
+        while(offset < fileEnd) {
+            if(indexAt(in, offset)) {
+                offset = validEnd = in.tellg();
+                continue;
+            }
+            uint64_t next = nextIntactRecord(in, offset + 1, fileEnd);
+            if(next == fileEnd) break;             // nothing intact follows: a torn tail
+            damaged++;
+            offset = next;
+        }
+        in.close();
+
+        // Cut only the torn tail, in place, so later appends land after good data and a crash
+        // here cannot cost the records before it
+        if(fileEnd > validEnd) {
+            error_code ec;
+            filesystem::resize_file(filename, validEnd, ec);
+        }
+    }
+
+    int append(const Route& r, int date, const string& driver) {
+        if(r.path.empty()) return -1;
+
+        string payload;
+        put(payload, (int32_t)date);
+        string name = driver.substr(0, 255);
+        put(payload, (uint8_t)name.size());
+        payload += name;
+        put(payload, (int32_t)r.totalDistance);
+        put(payload, (int32_t)r.totalWaste);
+        put(payload, (uint32_t)r.path.size());
+        for(int z : r.path) put(payload, (uint32_t)z);
+        if(payload.size() > MAX_PAYLOAD) return -1;
+
+        ofstream out(filename, ios::binary | ios::app);
+        if(!out) return -1;
+        out.seekp(0, ios::end);
+        uint64_t offset = out.tellp();
+
+        string record;
+        put(record, RECORD_MAGIC);
+        put(record, (uint32_t)payload.size());
+        record += payload;
+        put(record, checksum(payload));
+        out.write(record.data(), record.size());
+        out.flush();
+        if(!out) return -1;
+
+        Summary s;
+        s.date = date;
+        s.driver = internDriver(name);
+        s.start = r.path[0];
+        s.distance = r.totalDistance;
+        s.cost = RouteEvaluator::fuelCost(r.totalDistance);
+        s.waste = r.totalWaste;
+        s.stops = r.path.size();
+        s.offset = offset;
+        index(s);
+        return records.size() - 1;
+    }
+
+    // Full route including the stop list (one seek + read)
+    Route load(int rid) {
+        Route r;
+        const Summary& s = records[rid];
+        ifstream in(filename, ios::binary);
+        in.seekg(s.offset);
+        string payload;
+        bool wide;
+        Summary tmp;
+        vector<int> path;
+        if(!readRecord(in, payload, wide) || !parse(payload, wide, tmp, &path)) return r;
+
+        r.path = path;
+        r.totalDistance = s.distance;
+        r.totalCost = s.cost;
+        r.totalWaste = s.waste;
+        return r;
+    }
+
+    int size() const { return records.size(); }
+    bool empty() const { return records.empty(); }
+    int damagedRecords() const { return damaged; }
+    const Summary& summary(int rid) const { return records[rid]; }
+    const string& driverName(int rid) const { return driverNames[records[rid].driver]; }
+    const vector<int>& best(Metric m) const { return top[m]; }
+
+    vector<int> between(int fromDate, int toDate) const {
+        vector<int> out;
+        for(auto it = byDate.lower_bound(fromDate); it != byDate.end() && it->first <= toDate; ++it)
+            out.insert(out.end(), it->second.begin(), it->second.end());
+        return out;
+    }
+
+    vector<int> forDriver(const string& name) const {
+        auto it = driverId.find(name);
+        return it == driverId.end() ? vector<int>() : byDriver[it->second];
+    }
+
+    vector<int> fromZone(int zone) const {
+        auto it = byStart.find(zone);
+        return it == byStart.end() ? vector<int>() : it->second;
+    }
+
+    // Today's date as yyyymmdd
+    static int today() {
+        time_t now = time(0);
+        tm* t = localtime(&now);
+        return (t->tm_year + 1900) * 10000 + (t->tm_mon + 1) * 100 + t->tm_mday;
+    }
+};
+
+/**********************************************************************************************
+SENSOR FEED — BACKGROUND TAILER FOR LINE-DELIMITED FILL READINGS (FILE OR NAMED PIPE)
+Line format: "<zone id or ZONE_NAME> <fill level 0-100>". A reader thread parses lines into
+batches; the menu loop picks finished batches up at safe points and applies them in bulk.
+**********************************************************************************************/
+class SensorFeed {
+public:
+    struct Reading {
+        int zone;
+        int level;
+    };
+
+    static constexpr int BATCH_SIZE = 4096;
+
+private:
+    string path;
+    unordered_map<string, int> zoneByName;
+    int zoneCount = 0;
+
+#ifdef _WIN32
+    ifstream in;                            // the feed; a file being appended to is polled
+    mutex waitLock;
+    condition_variable stopSignal;          // stop() ends the reader's timed wait early
+#else
+    int fd = -1;                            // the feed, opened non-blocking
+    int wake[2] = {-1, -1};                 // stop() writes here to end the reader's wait
+#endif
+    bool untilEnd = false;                  // stop at end of file instead of tailing it
+    thread reader;
+    atomic<bool> running{false};
+    atomic<bool> finished{false};           // the reader has exited and published everything
+    string failure;                         // why the reader gave up; set before 'finished'
+    mutex queueLock;
+    vector<vector<Reading>> ready;          // parsed batches waiting for the main thread
+
+    atomic<long long> parsed{0};
+    atomic<long long> rejected{0};
+
+    static bool parseInt(const char*& p, const char* end, int& out) {
+        if(p == end || *p < '0' || *p > '9') return false;
+        int v = 0;
+        while(p != end && *p >= '0' && *p <= '9') v = v * 10 + (*p++ - '0');
+        out = v;
+        return true;
+    }
+
+    bool parseLine(const char* p, const char* end, Reading& r) const {
+        while(p != end && (*p == ' ' || *p == '\t')) p++;
+        const char* tok = p;
+        while(p != end && *p != ' ' && *p != '\t') p++;
+        if(tok == p) return false;
+
+        const char* q = tok;
+        if(!parseInt(q, p, r.zone) || q != p) {
+            auto it = zoneByName.find(string(tok, p));
+            if(it == zoneByName.end()) return false;
+            r.zone = it->second;
+        }
+        if(r.zone < 0 || r.zone >= zoneCount) return false;
+
+        while(p != end && (*p == ' ' || *p == '\t')) p++;
+        if(!parseInt(p, end, r.level) || r.level > 100) return false;
+        while(p != end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+        return p == end;
+    }
+
+    void publish(vector<Reading>& batch) {
+        if(batch.empty()) return;
+        lock_guard<mutex> guard(queueLock);
+        ready.push_back(move(batch));
+        batch.clear();
+        batch.reserve(BATCH_SIZE);
+    }
+
+#ifdef _WIN32
+    bool openSource(const string& file, bool fromStart) {
+        in.open(file, ios::binary);
+        if(!in) return false;
+        if(!fromStart) in.seekg(0, ios::end);
+        return true;
+    }
+
+    // Bytes read, 0 when caught up with the writer, -1 on a read error
+    long readChunk(char* buf, size_t size, bool& pipeEmpty) {
+        pipeEmpty = false;
+        in.read(buf, size);
+        long got = (long)in.gcount();
+        if(in.bad()) {
+            failure = "read error";
+            return -1;
+        }
+        if(got < (long)size) in.clear();      // end of file: later appends are read next time
+        return got;
+    }
+
+    void waitForData(bool) {
+        unique_lock<mutex> lock(waitLock);
+        stopSignal.wait_for(lock, chrono::milliseconds(20), [this] { return !running; });
+    }
+
+    void wakeReader() {
+        lock_guard<mutex> lock(waitLock);
+        stopSignal.notify_all();
+    }
+
+    void closeSource() {
+        if(in.is_open()) in.close();
+        in.clear();
+    }
+#else
+    bool openSource(const string& file, bool fromStart) {
+        fd = ::open(file.c_str(), O_RDONLY | O_NONBLOCK);
+        if(fd < 0) return false;
+        if(pipe(wake) != 0) {
+            closeSource();
+            return false;
+        }
+        if(!fromStart) lseek(fd, 0, SEEK_END);   // no effect on a pipe
+        return true;
+    }
+
+    // Bytes read, 0 when caught up with the writer, -1 on a read error
+    long readChunk(char* buf, size_t size, bool& pipeEmpty) {
+        ssize_t got;
+        do got = ::read(fd, buf, size); while(got < 0 && errno == EINTR);
+        pipeEmpty = got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+        if(pipeEmpty) return 0;
+        if(got < 0) failure = strerror(errno);
+        return got < 0 ? -1 : (long)got;
+    }
+
+    // An empty pipe wakes us when data arrives; a file at its end, or a pipe with no
+    // writer left, is polled again shortly
+    void waitForData(bool pipeEmpty) {
+        pollfd fds[2] = {{wake[0], POLLIN, 0}, {fd, POLLIN, 0}};
+        poll(fds, pipeEmpty ? 2 : 1, pipeEmpty ? -1 : 20);
+    }
+
+    void wakeReader() {
+        if(wake[1] != -1) {
+            ssize_t woken = ::write(wake[1], "x", 1);   // the reader may be waiting on an empty pipe
+            (void)woken;
+        }
+    }
+
+    void closeSource() {
+        auto closeFd = [](int& f) {
+            if(f != -1) ::close(f);
+            f = -1;
+        };
+        closeFd(fd);
+        closeFd(wake[0]);
+        closeFd(wake[1]);
+    }
+#endif
+
+    void run() {
+        vector<char> chunk(1 << 16);
+        string carry;                        // partial last line of the previous read
+        vector<Reading> batch;
+        batch.reserve(BATCH_SIZE);
+
+        while(running) {
+            // Takes whatever is there now, so a slow writer's lines are not held back
+            bool pipeEmpty;
+            long got = readChunk(chunk.data(), chunk.size(), pipeEmpty);
+            if(got < 0) break;                 // hard error: nothing more will come
+            if(got == 0 && untilEnd && !pipeEmpty) break;
+            if(got <= 0) {
+                // Caught up with the writer: hand over what we have and wait for more
+                publish(batch);
+                waitForData(pipeEmpty);
+                continue;
+            }
+
+            const char* p = chunk.data();
+            const char* end = p + got;
+            while(p != end) {
+                const char* nl = (const char*)memchr(p, '\n', end - p);
+                if(!nl) {
+                    carry.append(p, end);
+                    break;
+                }
+
+                Reading r;
+                bool ok;
+                if(carry.empty()) ok = parseLine(p, nl, r);
+                else {
+                    carry.append(p, nl);
+                    ok = parseLine(carry.data(), carry.data() + carry.size(), r);
+                    carry.clear();
+                }
+                if(ok) {
+                    batch.push_back(r);
+                    parsed++;
+                    if(batch.size() == BATCH_SIZE) publish(batch);
+                } else if(nl != p) {
+                    rejected++;
+                }
+                p = nl + 1;
+            }
+        }
+        publish(batch);
+        finished = true;
+    }
+
+public:
+    ~SensorFeed() {
+        stop();
+    }
+
+    // Regular files are tailed; on POSIX systems a named pipe is read as its writer sends,
+    // without blocking the open or keeping the writer waiting. 'toEnd' reads until end of
+    // file (a pipe: until its writer closes) and then stops; see drained().
+    bool start(const string& file, const vector<Zone>& zones, bool fromStart, bool toEnd = false) {
+        stop();
+        if(!openSource(file, fromStart)) return false;
+
+        path = file;
+        zoneCount = zones.size();
+        zoneByName.clear();
+        for(const Zone& z : zones) zoneByName[z.name] = z.id;
+        parsed = 0;
+        rejected = 0;
+        untilEnd = toEnd;
+        finished = false;
+        failure.clear();
+
+        running = true;
+        reader = thread(&SensorFeed::run, this);
+        return true;
+    }
+
+    void stop() {
+        running = false;
+        wakeReader();
+        if(reader.joinable()) reader.join();
+        closeSource();
+    }
+
+    // Non-blocking for the reader: swaps out whatever batches are complete
+    vector<vector<Reading>> take() {
+        vector<vector<Reading>> out;
+        lock_guard<mutex> guard(queueLock);
+        out.swap(ready);
+        return out;
+    }
+
+    bool active() const { return running; }
+    bool drained() const { return finished; }
+    // Empty unless the reader stopped on a read error
+    string readError() const { return finished ? failure : string(); }
+    const string& source() const { return path; }
+    long long readingsParsed() const { return parsed; }
+    long long readingsRejected() const { return rejected; }
+};
+
+/**********************************************************************************************
+EPOCH-BASED SNAPSHOT PUBLICATION (RCU STYLE)
+One writer at a time builds a fresh immutable T and publishes it with a single pointer swap.
+Readers pin the current version without taking a lock: they announce the global epoch in a
+reader slot, then load the pointer. A retired version is freed only once every pinned slot
+has moved past the epoch in which it was replaced.
+**********************************************************************************************/
+template<class T>
+class EpochSnapshot {
+public:
+    static constexpr int MAX_READERS = 64;
+
+private:
+    static constexpr uint64_t IDLE = ~uint64_t(0);
+
+    struct alignas(64) Slot {              // one cache line per reader, no false sharing
+        atomic<uint64_t> epoch{IDLE};
+    };
+
+    atomic<const T*> current{nullptr};
+    atomic<uint64_t> globalEpoch{1};
+    Slot slots[MAX_READERS];
+
+    mutex writerLock;                      // serialises writers only; readers never touch it
+    vector<pair<const T*, uint64_t>> retired;
+    atomic<long long> reclaimedCount{0};
+
+    uint64_t oldestPinned() const {
+        uint64_t oldest = IDLE;
+        for(const Slot& s : slots) oldest = min(oldest, s.epoch.load());
+        return oldest;
+    }
+
+    // Caller holds writerLock
+    void reclaim() {
+        uint64_t oldest = oldestPinned();
+        size_t kept = 0;
+        for(auto& r : retired) {
+            if(r.second <= oldest) {
+                delete r.first;
+                reclaimedCount++;
+            } else {
+                retired[kept++] = r;
+            }
+        }
+        retired.resize(kept);
+    }
+
+public:
+    // RAII pin: the version stays alive (and unchanged) until the guard goes out of scope
+    class Guard {
+    private:
+        Slot* slot;
+        const T* ptr;
+        friend class EpochSnapshot;
+        Guard(Slot* s, const T* p) : slot(s), ptr(p) {}
+
+    public:
+        Guard(Guard&& o) noexcept : slot(o.slot), ptr(o.ptr) { o.slot = nullptr; }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        ~Guard() { if(slot) slot->epoch.store(IDLE); }
+
+        const T& operator*() const { return *ptr; }
+        const T* operator->() const { return ptr; }
+        explicit operator bool() const { return ptr != nullptr; }
+    };
+
+    ~EpochSnapshot() {
+        delete current.load();
+        for(auto& r : retired) delete r.first;
+    }
+
+    Guard pin() {
+        while(true) {
+            for(Slot& s : slots) {
+                uint64_t idle = IDLE;
+                uint64_t e = globalEpoch.load();
+                if(s.epoch.compare_exchange_strong(idle, e)) {
+                    // seq_cst: the epoch announcement is visible before the pointer is read
+                    return Guard(&s, current.load());
+                }
+            }
+            this_thread::yield();          // more than MAX_READERS pins at once: wait for one
+        }
+    }
+
+    // Takes ownership of 'next'. Readers pinned before the swap keep the old version.
+    void publish(const T* next) {
+        lock_guard<mutex> guard(writerLock);
+        const T* old = current.exchange(next);
+        uint64_t retireEpoch = globalEpoch.fetch_add(1) + 1;
+        if(old) retired.push_back({old, retireEpoch});
+        reclaim();
+    }
+
+    // Writer-side peek at the latest version (for copy-on-write of the next one)
+    const T* latest() const { return current.load(); }
+
+    long long reclaimed() const { return reclaimedCount; }
+    size_t pendingReclaim() {
+        lock_guard<mutex> guard(writerLock);
+        return retired.size();
+    }
+};
+
+/**********************************************************************************************
+ZONE STATE VERSION — WHAT CONCURRENT READERS (STATS, SEARCH, WHAT-IF SCENARIOS) SEE
+Route builders are not readers of it: they empty the zones they collect and log the route, so
+they run on the main thread against the live zones, between sensor batches.
+**********************************************************************************************/
+struct ZoneState {
+    uint64_t version;
+    vector<int> waste;
+    vector<int> priority;
+    vector<int> historyMax;      // segment tree maximum per zone at publish time
+    vector<char> depot;
+    vector<int> levelCount;      // zones per waste % (0-100), copied from the fill-level index
+    vector<int> byLevel;         // zone ids bucketed by waste %, ascending id within a bucket
+    vector<int> levelStart;      // byLevel offset of each waste % bucket, plus the end
+    long long totalWaste;        // kept with the arrays so a torn read is detectable
+
+    int size() const { return waste.size(); }
+
+    // Zones of this version with waste in [lo, hi], bucket by bucket
+    void inRange(int lo, int hi, vector<int>& out) const {
+        out.clear();
+        lo = max(lo, 0);
+        hi = min(hi, (int)levelStart.size() - 2);
+        if(lo > hi) return;
+        out.assign(byLevel.begin() + levelStart[lo], byLevel.begin() + levelStart[hi + 1]);
+    }
+};
+
+/**********************************************************************************************
+NEAREST FACILITY INDEX — MULTI-SOURCE DIJKSTRA OVER ALL DUMPING YARDS / TRANSFER STATIONS
+**********************************************************************************************/
+class NearestFacilityIndex {
+private:
+    vector<int> nearestDist;
+    vector<int> nearestFacility;
+
+    // Relaxes outwards from the seeded nodes; only nodes that get strictly closer are touched
+    void propagate(const vector<vector<Edge>>& adj, MinHeap& pq) {
+        while(!pq.empty()) {
+            pair<int, int> cur = pq.pop();
+            int u = cur.second;
+            if(cur.first > nearestDist[u]) continue;
+
+            for(auto& e : adj[u]) {
+                int nd = cur.first + e.weight;
+                if(nd < nearestDist[e.to]) {
+                    nearestDist[e.to] = nd;
+                    nearestFacility[e.to] = nearestFacility[u];
+                    pq.push(nd, e.to);
+                }
+            }
+        }
+    }
+
+public:
+    void build(const vector<vector<Edge>>& adj, const vector<int>& facilities) {
+        nearestDist.assign(adj.size(), INF);
+        nearestFacility.assign(adj.size(), -1);
+
+        MinHeap pq;
+        for(int f : facilities) {
+            nearestDist[f] = 0;
+            nearestFacility[f] = f;
+            pq.push(0, f);
+        }
+        propagate(adj, pq);
+    }
+
+    // Incremental update when a new facility opens: a pruned Dijkstra from f alone
+    void addFacility(const vector<vector<Edge>>& adj, int f) {
+        if(nearestDist[f] == 0) return;
+        nearestDist[f] = 0;
+        nearestFacility[f] = f;
+
+        MinHeap pq;
+        pq.push(0, f);
+        propagate(adj, pq);
+    }
+
+    int facility(int zone) const {
+        return nearestFacility[zone];
+    }
+
+    int distance(int zone) const {
+        return nearestDist[zone];
+    }
+};
+
+/**********************************************************************************************
+FILL-LEVEL INDEX — ONE BUCKET PER WASTE PERCENTAGE (0-100)
+Zones sit in intrusive doubly linked lists, one per level, plus a 101-bit occupancy mask.
+A level change is an O(1) unlink/link; top-k, threshold and range queries walk only the
+non-empty buckets they need, and the status counts are sums over at most 101 counters.
+Order inside a bucket is arbitrary: callers that print in zone order sort the result ids.
+**********************************************************************************************/
+class FillLevelIndex {
+public:
+    static constexpr int LEVELS = 101;
+
+private:
+    vector<int> level;   // bucket of each zone
+    vector<int> next, prev;
+    int head[LEVELS];
+    int count[LEVELS];
+    uint64_t occupied[2];
+    long long total = 0;
+
+    static int clampLevel(int waste) {
+        return min(LEVELS - 1, max(0, waste));
+    }
+
+    void link(int zone, int b) {
+        level[zone] = b;
+        prev[zone] = -1;
+        next[zone] = head[b];
+        if(head[b] != -1) prev[head[b]] = zone;
+        head[b] = zone;
+        count[b]++;
+        occupied[b >> 6] |= uint64_t(1) << (b & 63);
+    }
+
+    void unlink(int zone) {
+        int b = level[zone];
+        if(prev[zone] != -1) next[prev[zone]] = next[zone];
+        else head[b] = next[zone];
+        if(next[zone] != -1) prev[next[zone]] = prev[zone];
+        if(--count[b] == 0) occupied[b >> 6] &= ~(uint64_t(1) << (b & 63));
+    }
+
+    // Highest non-empty bucket <= b, or -1
+    int occupiedAtOrBelow(int b) const {
+        if(b >= 64) {
+            uint64_t hi = occupied[1] & (~uint64_t(0) >> (63 - (b - 64)));
+            if(hi) return 64 + 63 - __builtin_clzll(hi);
+            b = 63;
+        }
+        if(b < 0) return -1;
+        uint64_t lo = occupied[0] & (~uint64_t(0) >> (63 - b));
+        return lo ? 63 - __builtin_clzll(lo) : -1;
+    }
+
+public:
+    FillLevelIndex() {
+        build({});
+    }
+
+    void build(const vector<int>& wastes) {
+        int n = wastes.size();
+        level.assign(n, 0);
+        next.assign(n, -1);
+        prev.assign(n, -1);
+        fill(head, head + LEVELS, -1);
+        fill(count, count + LEVELS, 0);
+        occupied[0] = occupied[1] = 0;
+        total = 0;
+        for(int z = n - 1; z >= 0; z--) {
+            link(z, clampLevel(wastes[z]));
+            total += level[z];
+        }
+    }
+
+    void update(int zone, int waste) {
+        int b = clampLevel(waste);
+        if(b == level[zone]) return;
+        total += b - level[zone];
+        unlink(zone);
+        link(zone, b);
+    }
+
+    // Fullest first, at most k zones
+    void topK(int k, vector<int>& out) const {
+        out.clear();
+        for(int b = occupiedAtOrBelow(LEVELS - 1); b != -1 && (int)out.size() < k; b = occupiedAtOrBelow(b - 1))
+            for(int z = head[b]; z != -1 && (int)out.size() < k; z = next[z]) out.push_back(z);
+    }
+
+    // Zones with lo <= waste <= hi, fullest first
+    void inRange(int lo, int hi, vector<int>& out) const {
+        out.clear();
+        if(hi < 0 || lo >= LEVELS) return;
+        lo = clampLevel(lo);
+        for(int b = occupiedAtOrBelow(min(hi, LEVELS - 1)); b >= lo; b = occupiedAtOrBelow(b - 1))
+            for(int z = head[b]; z != -1; z = next[z]) out.push_back(z);
+    }
+
+    void atLeast(int threshold, vector<int>& out) const {
+        inRange(threshold, LEVELS - 1, out);
+    }
+
+    int countInRange(int lo, int hi) const {
+        int c = 0;
+        for(int b = clampLevel(lo); b <= min(hi, LEVELS - 1); b++) c += count[b];
+        return c;
+    }
+
+    int critical() const { return countInRange(81, 100); }   // same bands as the status colours
+    int warning() const { return countInRange(51, 80); }
+    int healthy() const { return countInRange(0, 50); }
+
+    int highest() const { return occupiedAtOrBelow(LEVELS - 1); }
+    int lowest() const {
+        for(int b = 0; b < LEVELS; b++) if(count[b]) return b;
+        return -1;
+    }
+
+    long long totalWaste() const { return total; }
+    int size() const { return level.size(); }
+    const int* histogram() const { return count; }
+};
+
+/**********************************************************************************************
+INCREMENTAL PRIORITY ORDER — ZONES BY WASTE (HIGH FIRST), THEN KM TO THE NEAREST YARD
+Built with one radix sort. After that a single fill-level change finds the zone's old and new
+slots by binary search and moves it with one rotate. Large batches rebuild in O(N).
+**********************************************************************************************/
+class PriorityOrder {
+private:
+    vector<int> order;   // zone ids, most urgent first
+    vector<int> key;     // packed composite key per zone (smaller = more urgent)
+
+    bool ahead(int a, int b) const {
+        return key[a] < key[b] || (key[a] == key[b] && a < b);
+    }
+
+    // (key, zone) pairs are unique, so a zone's slot is found by binary search on its key
+    int slotOf(int zone, int zoneKey) const {
+        return lower_bound(order.begin(), order.end(), zone, [&](int a, int z) {
+            return key[a] < zoneKey || (key[a] == zoneKey && a < z);
+        }) - order.begin();
+    }
+
+public:
+    static constexpr int KM_BITS = 20;
+
+    // (100 - waste) in the high bits, km to the yard below: one integer compare orders both
+    static int makeKey(int waste, int yardKm) {
+        int w = 100 - min(100, max(0, waste));
+        return (w << KM_BITS) | min(max(yardKm, 0), (1 << KM_BITS) - 1);
+    }
+
+    void rebuild(const vector<int>& keys) {
+        int n = keys.size();
+        key = keys;
+        order.resize(n);
+
+        ArenaScope scope;
+        pmr::vector<SortingAlgorithms::SortKey> pairs(n, scratchResource()), buffer(n, scratchResource());
+        for(int i = 0; i < n; i++) pairs[i] = {key[i], i};
+        SortingAlgorithms::radixSort(pairs.data(), buffer.data(), n);
+
+        for(int i = 0; i < n; i++) order[i] = pairs[i].index;
+    }
+
+    // Two binary searches (old and new slot) and one rotate of the zones in between, which
+    // shift by one slot as a single memmove
+    void update(int zone, int newKey) {
+        if(key[zone] == newKey) return;
+        int p = slotOf(zone, key[zone]);
+        key[zone] = newKey;
+
+        auto first = order.begin();
+        if(p > 0 && ahead(zone, order[p - 1])) {
+            int q = lower_bound(first, first + p, zone, [this](int a, int z) { return ahead(a, z); }) - first;
+            rotate(first + q, first + p, first + p + 1);
+        } else if(p + 1 < (int)order.size() && ahead(order[p + 1], zone)) {
+            int q = upper_bound(first + p + 1, order.end(), zone, [this](int z, int b) { return ahead(z, b); }) - first;
+            rotate(first + p, first + p + 1, first + q);
+        }
+    }
+
+    const vector<int>& zonesInOrder() const { return order; }
+    int rank(int zone) const { return slotOf(zone, key[zone]); }
+    int size() const { return order.size(); }
+};
+
+/**********************************************************************************************
+WASTE FORECASTER — DAMPED HOLT-WINTERS WITH WEEKLY SEASONALITY, ONE MODEL PER ZONE
+Level, trend and the seven seasonal offsets live in flat arrays (structure of arrays), so a
+forecast for every zone is one branch-free pass. Each zone's seasonal offsets are kept rotated
+so that slot k is always "k+1 days after the last reading": a new reading updates slot 0 and
+rotates, and a batch forecast for h days ahead reads the same slot for every zone.
+Bins only fill up between collections, so a reading far below the smoothed level is taken as
+a collection: the level restarts there and the learned growth is kept. Forecasts start from
+the current fill (which collections reset) and add the expected growth.
+One smoothing step is one calendar day, whatever the sensor rate: a later reading on the same
+day undoes that day's step and redoes it, so each day counts with its last reading.
+**********************************************************************************************/
+class WasteForecaster {
+public:
+    static constexpr int SEASON = 7;
+    static constexpr float DEFAULT_GROWTH = 10.0f;   // % per day while no zone has a trend yet
+
+private:
+    static constexpr float ALPHA = 0.5f;   // level smoothing
+    static constexpr float BETA = 0.2f;    // trend smoothing
+    static constexpr float GAMMA = 0.3f;   // seasonal smoothing
+    static constexpr float PHI = 0.9f;     // trend damping: long horizons flatten out
+    static constexpr float COLLECTION_DROP = 20.0f;
+
+    vector<float> level;
+    vector<float> trend;
+    vector<float> season;                  // SEASON per zone, rotated (slot 0 = next day)
+    vector<int> observed;                  // readings folded in so far
+    vector<char> trendKnown;               // a trend has been measured
+    vector<int> lastDay;                   // day number of the latest folded reading
+    vector<float> dayLevel, dayTrend, dayOffset;   // state before that day's step, to redo it
+    vector<char> dayKnown;
+    double trendSum = 0;                   // sum of rising trends over zones that have one
+    int trendedZones = 0;
+
+    void countTrend(int z, int sign) {
+        if(!trendKnown[z]) return;
+        trendSum += sign * max(0.0f, trend[z]);
+        trendedZones += sign;
+    }
+
+    // One smoothing step for reading number n; 'offset' is the seasonal slot of this day.
+    // The seasonal part starts once a full week has been seen.
+    // The trend is first set from two consecutive readings without a collection between.
+    static void smooth(float& lv, float& tr, float& offset, char& known, int n, float y) {
+        if(n == 0) {
+            lv = y;
+            tr = 0;
+            known = 0;
+            return;
+        }
+        if(y + COLLECTION_DROP < lv) {
+            lv = y;
+            return;
+        }
+        if(!known) {
+            tr = y - lv;
+            lv = y;
+            known = 1;
+            return;
+        }
+
+        bool seasonal = n >= SEASON;
+        float prev = lv;
+        lv = ALPHA * (y - (seasonal ? offset : 0.0f)) + (1 - ALPHA) * (prev + PHI * tr);
+        tr = BETA * (lv - prev) + (1 - BETA) * PHI * tr;
+        if(seasonal) offset = GAMMA * (y - lv) + (1 - GAMMA) * offset;
+    }
+
+    // Fitting walks a local ring and rotates into place once at the end. History holds one
+    // reading per day, the last one taken on zone.historyDay ('today' if that is unknown).
+    void fitZone(int z, const Zone& zone, int today) {
+        float lv = zone.currentWaste, tr = 0;
+        float ring[SEASON] = {};
+        char known = 0;
+        int n = 0;
+        for(int y : zone.history) {
+            dayLevel[z] = lv;
+            dayTrend[z] = tr;
+            dayOffset[z] = ring[n % SEASON];
+            dayKnown[z] = known;
+            smooth(lv, tr, ring[n % SEASON], known, n, y);
+            n++;
+        }
+        level[z] = lv;
+        trend[z] = tr;
+        trendKnown[z] = known;
+        observed[z] = n;
+        lastDay[z] = zone.historyDay ? zone.historyDay : today;
+        for(int k = 0; k < SEASON; k++) season[(size_t)z * SEASON + k] = ring[(n + k) % SEASON];
+    }
+
+    // phi + phi^2 + ... + phi^days
+    static float dampedSteps(int days) {
+        float sum = 0, p = 1;
+        for(int i = 0; i < days; i++) {
+            p *= PHI;
+            sum += p;
+        }
+        return sum;
+    }
+
+    void resizeZones(int n) {
+        level.resize(n, 0);
+        trend.resize(n, 0);
+        season.resize((size_t)n * SEASON, 0);
+        observed.resize(n, 0);
+        trendKnown.resize(n, 0);
+        lastDay.resize(n, 0);
+        dayLevel.resize(n, 0);
+        dayTrend.resize(n, 0);
+        dayOffset.resize(n, 0);
+        dayKnown.resize(n, 0);
+    }
+
+public:
+    // Local calendar day number (days since 1970-01-01), the unit of one smoothing step.
+    // Counted from the local date itself, so it needs no time zone offset and DST cannot
+    // shift it.
+    static int today() {
+        time_t now = time(nullptr);
+        tm local = *localtime(&now);
+        return dayNumber(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
+    }
+
+    // Days from 1970-01-01 to y-m-d in the proleptic Gregorian calendar
+    static int dayNumber(int y, int m, int d) {
+        y -= m <= 2;
+        int era = (y >= 0 ? y : y - 399) / 400;
+        int yearOfEra = y - era * 400;
+        int dayOfYear = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        return era * 146097 + dayOfEra - 719468;
+    }
+
+    // Fits every zone from its history in one pass, zones split across the pool
+    void fit(const vector<Zone>& zones, WorkStealingPool& pool, int day = today()) {
+        int n = zones.size();
+        *this = WasteForecaster();
+        resizeZones(n);
+        pool.parallelFor(0, n, 4096, [&](int lo, int hi) {
+            for(int z = lo; z < hi; z++) fitZone(z, zones[z], day);
+        });
+        trendSum = 0;
+        trendedZones = 0;
+        for(int z = 0; z < n; z++) countTrend(z, +1);
+    }
+
+    void addZone(const Zone& zone) {
+        int z = size();
+        resizeZones(z + 1);
+        fitZone(z, zone, today());
+        countTrend(z, +1);
+    }
+
+    // Incremental update with a reading taken on 'day': O(1), no refit.
+    // Days without a reading only advance the seasonal slot.
+    void observe(int zone, int waste, int day) {
+        if(zone >= size()) return;
+        float* s = &season[(size_t)zone * SEASON];
+        countTrend(zone, -1);
+        if(observed[zone] > 0 && day <= lastDay[zone]) {
+            rotate(s, s + SEASON - 1, s + SEASON);
+            level[zone] = dayLevel[zone];
+            trend[zone] = dayTrend[zone];
+            s[0] = dayOffset[zone];
+            trendKnown[zone] = dayKnown[zone];
+            observed[zone]--;
+            day = lastDay[zone];
+        } else if(observed[zone] > 0) {
+            int skipped = min(day - lastDay[zone] - 1, SEASON);
+            rotate(s, s + skipped % SEASON, s + SEASON);
+        }
+
+        dayLevel[zone] = level[zone];
+        dayTrend[zone] = trend[zone];
+        dayOffset[zone] = s[0];
+        dayKnown[zone] = trendKnown[zone];
+        lastDay[zone] = day;
+        smooth(level[zone], trend[zone], s[0], trendKnown[zone], observed[zone]++, waste);
+        countTrend(zone, +1);
+        rotate(s, s + 1, s + SEASON);
+    }
+
+    // Growth expected over the next 'days' days (1 = by tomorrow). The current fill already
+    // carries today's seasonal offset (slot SEASON-1), so only the change in offset is added.
+    float growth(int zone, int days) const {
+        if(days <= 0) return 0;
+        const float* s = &season[(size_t)zone * SEASON];
+        return dampedSteps(days) * trend[zone] + s[(days - 1) % SEASON] - s[SEASON - 1];
+    }
+
+    // Fill % expected 'days' from now, starting at the zone's current fill
+    int forecast(int zone, int current, int days) const {
+        return clampPercent(current + growth(zone, days));
+    }
+
+    // Same for every zone at once: out[z] from current[z], z in [0, size)
+    void forecastAll(int days, const int* current, int* out) const {
+        int n = size();
+        if(days <= 0) {
+            copy(current, current + n, out);
+            return;
+        }
+        float damp = dampedSteps(days);
+        const float* tr = trend.data();
+        const float* sp = season.data() + (days - 1) % SEASON;
+        const float* today = season.data() + SEASON - 1;
+        for(int z = 0; z < n; z++) {
+            float f = current[z] + damp * tr[z] + sp[(size_t)z * SEASON] - today[(size_t)z * SEASON];
+            f = f < 0.0f ? 0.0f : (f > 100.0f ? 100.0f : f);
+            out[z] = (int)(f + 0.5f);
+        }
+    }
+
+    static int clampPercent(float f) {
+        return (int)(max(0.0f, min(100.0f, f)) + 0.5f);
+    }
+
+    // Mean rising trend over zones with one; DEFAULT_GROWTH before any zone has a trend
+    float averageGrowth() const {
+        return trendedZones ? trendSum / trendedZones : DEFAULT_GROWTH;
+    }
+
+    // Rise expected by tomorrow, never negative; zones without a trend get the average
+    float dailyGrowth(int zone) const {
+        return trendKnown[zone] ? max(0.0f, growth(zone, 1)) : averageGrowth();
+    }
+
+    float trendOf(int zone) const { return trend[zone]; }
+    float seasonalOffset(int zone, int days) const {
+        return days <= 0 ? 0.0f : season[(size_t)zone * SEASON + (days - 1) % SEASON];
+    }
+    int readings(int zone) const { return observed[zone]; }
+    bool hasTrend(int zone) const { return trendKnown[zone]; }
+    int size() const { return level.size(); }
+};
+
+/**********************************************************************************************
+OVERFLOW EARLY-WARNING INDEX — ZONES IN AN INDEXED MIN-HEAP BY PROJECTED TIME OF FULL
+Entries hold the absolute minute a zone is expected to fill up, so a zone with no new reading
+still comes due as the clock advances. A new estimate for one zone moves it up or down in
+O(log n). "Which zones are full by T" walks the heap from the root and stops at the first
+entry later than T on every branch, so it touches only the k answers and their children.
+**********************************************************************************************/
+class OverflowEtaIndex {
+public:
+    static constexpr int NEVER = INT_MAX;    // not filling up
+
+    // Wall-clock minutes since the epoch; the time base for deadlines
+    static int now() {
+        return (int)(time(nullptr) / 60);
+    }
+
+private:
+    vector<int> heap;     // zone ids, heap-ordered by (deadline, zone)
+    vector<int> pos;      // zone -> slot in heap
+    vector<int> due;      // zone -> minute it is projected to be full
+
+    bool before(int a, int b) const {
+        return due[a] != due[b] ? due[a] < due[b] : a < b;
+    }
+
+    void place(int slot, int zone) {
+        heap[slot] = zone;
+        pos[zone] = slot;
+    }
+
+    void siftUp(int slot) {
+        int zone = heap[slot];
+        while(slot > 0) {
+            int parent = (slot - 1) / 2;
+            if(!before(zone, heap[parent])) break;
+            place(slot, heap[parent]);
+            slot = parent;
+        }
+        place(slot, zone);
+    }
+
+    void siftDown(int slot) {
+        int n = heap.size();
+        int zone = heap[slot];
+        while(true) {
+            int child = 2 * slot + 1;
+            if(child >= n) break;
+            if(child + 1 < n && before(heap[child + 1], heap[child])) child++;
+            if(!before(heap[child], zone)) break;
+            place(slot, heap[child]);
+            slot = child;
+        }
+        place(slot, zone);
+    }
+
+public:
+    void build(const vector<int>& deadlines) {
+        int n = deadlines.size();
+        due = deadlines;
+        heap.resize(n);
+        pos.resize(n);
+        for(int z = 0; z < n; z++) place(z, z);
+        for(int slot = n / 2 - 1; slot >= 0; slot--) siftDown(slot);
+    }
+
+    void update(int zone, int deadline) {
+        if(zone >= (int)due.size() || due[zone] == deadline) return;
+        bool sooner = deadline < due[zone];
+        due[zone] = deadline;
+        if(sooner) siftUp(pos[zone]);
+        else siftDown(pos[zone]);
+    }
+
+    // Zones full by minute 'deadline' (already full included), soonest first
+    void dueBy(int deadline, vector<int>& out) const {
+        out.clear();
+        if(heap.empty()) return;
+        vector<int> stack = {0};
+        while(!stack.empty()) {
+            int slot = stack.back();
+            stack.pop_back();
+            if(due[heap[slot]] > deadline) continue;
+            out.push_back(heap[slot]);
+            for(int child = 2 * slot + 1; child <= 2 * slot + 2 && child < (int)heap.size(); child++)
+                stack.push_back(child);
+        }
+        sort(out.begin(), out.end(), [this](int a, int b) { return before(a, b); });
+    }
+
+    int soonest() const { return heap.empty() ? -1 : heap[0]; }
+    int deadline(int zone) const { return due[zone]; }
+    int size() const { return due.size(); }
+
+    // Minutes from 'at' until the zone is full (0 = already full)
+    int minutesLeft(int zone, int at) const {
+        return due[zone] == NEVER ? NEVER : max(0, due[zone] - at);
+    }
+};
+
+/**********************************************************************************************
+TERRITORY PARTITIONING — BALANCED BUBBLE GROWTH WITH K-MEDOID CENTRES
+Seeds are spread by farthest-first traversal on road distance. Districts then grow from their
+medoids one zone at a time, and the lightest district always claims next: its nearest
+unclaimed frontier zone. Growth follows roads, so every district is contiguous. A district's
+load is its expected waste plus the km of the spanning tree it grew, because a truck tour
+through the district is at most twice that tree. Each medoid then moves to the zone deepest
+inside its district, and the districts grow again until the medoids settle.
+**********************************************************************************************/
+class TerritoryPartitioner {
+public:
+    static constexpr int MAX_ROUNDS = 8;
+
+private:
+    vector<int> owner;      // zone -> district
+    vector<int> medoids;
+    vector<int> loads, wastes, treeKms, zoneCounts;
+    int roundsRun = 0;
+
+    // Farthest-first seeding, each pick weighted by its expected waste
+    void seed(const vector<vector<Edge>>& adj, const vector<int>& weight, int k, int first) {
+        int n = adj.size();
+        NearestFacilityIndex nearest;
+        medoids.assign(1, first);
+        nearest.build(adj, medoids);
+        while((int)medoids.size() < k) {
+            int next = -1;
+            long long bestScore = 0;
+            for(int z = 0; z < n; z++) {
+                int d = nearest.distance(z);
+                if(d == INF) continue;          // other road components are handled in grow()
+                long long score = (long long)d * weight[z];
+                if(score > bestScore) bestScore = score, next = z;
+            }
+            if(next == -1) break;               // fewer reachable zones than districts
+            medoids.push_back(next);
+            nearest.addFacility(adj, next);
+        }
+    }
+
+    void claim(const vector<vector<Edge>>& adj, const vector<int>& weight, int v, int d) {
+        int treeEdge = INF;
+        for(auto& e : adj[v])
+            if(owner[e.to] == d) treeEdge = min(treeEdge, e.weight);
+        if(treeEdge == INF) treeEdge = 0;       // a medoid, or the first zone of a stray component
+
+        owner[v] = d;
+        loads[d] += weight[v] + treeEdge;
+        wastes[d] += weight[v];
+        treeKms[d] += treeEdge;
+        zoneCounts[d]++;
+    }
+
+    void grow(const vector<vector<Edge>>& adj, const vector<int>& weight) {
+        int n = adj.size();
+        int k = medoids.size();
+        owner.assign(n, -1);
+        loads.assign(k, 0);
+        wastes.assign(k, 0);
+        treeKms.assign(k, 0);
+        zoneCounts.assign(k, 0);
+
+        // frontier[d]: (road km from the medoid through the district, zone)
+        vector<MinHeap> frontier(k);
+        auto extend = [&](int v, int d, int key) {
+            for(auto& e : adj[v])
+                if(owner[e.to] == -1) frontier[d].push(key + e.weight, e.to);
+        };
+
+        MinHeap lightest;                       // one entry per district still growing
+        for(int d = 0; d < k; d++) claim(adj, weight, medoids[d], d);
+        for(int d = 0; d < k; d++) {
+            extend(medoids[d], d, 0);
+            lightest.push(loads[d], d);
+        }
+
+        while(!lightest.empty()) {
+            int d = lightest.pop().second;
+            int v = -1, key = 0;
+            while(!frontier[d].empty()) {
+                pair<int, int> c = frontier[d].pop();
+                if(owner[c.second] == -1) { key = c.first; v = c.second; break; }
+            }
+            if(v == -1) continue;               // boxed in by its neighbours: finished
+            claim(adj, weight, v, d);
+            extend(v, d, key);
+            lightest.push(loads[d], d);
+        }
+
+        // Road components without a medoid go whole to the lightest district
+        for(int z = 0; z < n; z++) {
+            if(owner[z] != -1) continue;
+            int d = min_element(loads.begin(), loads.end()) - loads.begin();
+            MinHeap component;
+            component.push(0, z);
+            while(!component.empty()) {
+                pair<int, int> c = component.pop();
+                if(owner[c.second] != -1) continue;
+                claim(adj, weight, c.second, d);
+                for(auto& e : adj[c.second])
+                    if(owner[e.to] == -1) component.push(c.first + e.weight, e.to);
+            }
+        }
+    }
+
+    // The zone of each district farthest from its border, walking only inside the district
+    vector<int> centres(const vector<vector<Edge>>& adj) const {
+        int n = adj.size();
+        vector<int> inward(n, INF);
+        MinHeap pq;
+        for(int z = 0; z < n; z++)
+            for(auto& e : adj[z])
+                if(owner[e.to] != owner[z]) { inward[z] = 0; pq.push(0, z); break; }
+
+        while(!pq.empty()) {
+            pair<int, int> cur = pq.pop();
+            int u = cur.second;
+            if(cur.first > inward[u]) continue;
+            for(auto& e : adj[u]) {
+                int nd = cur.first + e.weight;
+                if(owner[e.to] == owner[u] && nd < inward[e.to]) {
+                    inward[e.to] = nd;
+                    pq.push(nd, e.to);
+                }
+            }
+        }
+
+        vector<int> next = medoids;             // a district with no border keeps its medoid
+        vector<int> deepest(medoids.size(), -1);
+        for(int z = 0; z < n; z++) {
+            int d = owner[z];
+            if(inward[z] != INF && inward[z] > deepest[d]) deepest[d] = inward[z], next[d] = z;
+        }
+        return next;
+    }
+
+public:
+    // weight[z] >= 1: expected waste of zone z. 'first' seeds district 0.
+    void partition(const vector<vector<Edge>>& adj, const vector<int>& weight, int k, int first) {
+        int n = adj.size();
+        owner.clear();
+        medoids.clear();
+        roundsRun = 0;
+        if(n == 0) return;
+        k = max(1, min(k, n));
+
+        seed(adj, weight, k, first);
+        for(roundsRun = 1; ; roundsRun++) {
+            grow(adj, weight);
+            if(roundsRun == MAX_ROUNDS) break;
+            vector<int> next = centres(adj);
+            if(next == medoids) break;
+            medoids = next;
+        }
+    }
+
+    // Connected pieces over all districts; equals count() when every district is contiguous
+    int fragments(const vector<vector<Edge>>& adj) const {
+        int pieces = 0;
+        vector<char> seen(owner.size(), 0);
+        vector<int> stack;
+        for(int z = 0; z < (int)owner.size(); z++) {
+            if(seen[z]) continue;
+            pieces++;
+            seen[z] = 1;
+            stack.push_back(z);
+            while(!stack.empty()) {
+                int u = stack.back();
+                stack.pop_back();
+                for(auto& e : adj[u])
+                    if(!seen[e.to] && owner[e.to] == owner[u]) seen[e.to] = 1, stack.push_back(e.to);
+            }
+        }
+        return pieces;
+    }
+
+    // Heaviest district load over the mean; 1.0 is perfect balance
+    double imbalance() const {
+        if(loads.empty()) return 1.0;
+        long long total = accumulate(loads.begin(), loads.end(), 0LL);
+        return total == 0 ? 1.0 : (double)*max_element(loads.begin(), loads.end()) * loads.size() / total;
+    }
+
+    int count() const { return medoids.size(); }
+    int district(int zone) const { return owner[zone]; }
+    int medoid(int d) const { return medoids[d]; }
+    int load(int d) const { return loads[d]; }
+    int waste(int d) const { return wastes[d]; }
+    int treeKm(int d) const { return treeKms[d]; }
+    int zoneCount(int d) const { return zoneCounts[d]; }
+    int rounds() const { return roundsRun; }
+};
+
+/**********************************************************************************************
+WHAT-IF SCENARIOS — COPY-ON-WRITE OVERLAY ON A PINNED ZONE STATE
+Reads fall through to the immutable base version; only fill levels a scenario changes are
+stored, so many scenarios can share one base without copying the zone arrays.
+**********************************************************************************************/
+class ZoneOverlay {
+private:
+    const ZoneState* base;
+    unordered_map<int, int> changed;    // zone -> waste % in this scenario
+
+public:
+    explicit ZoneOverlay(const ZoneState& state) : base(&state) {}
+
+    int size() const { return base->size(); }
+    bool isDepot(int zone) const { return base->depot[zone]; }
+
+    int waste(int zone) const {
+        auto it = changed.find(zone);
+        return it == changed.end() ? base->waste[zone] : it->second;
+    }
+
+    void setWaste(int zone, int waste) {
+        waste = max(0, min(100, waste));
+        if(waste == base->waste[zone]) changed.erase(zone);
+        else changed[zone] = waste;
+    }
+
+    int changedCount() const { return changed.size(); }
+};
+
+struct Scenario {
+    string name;
+    vector<int> spreadOrigins;             // spread events, +10% per hop as in bfsSpread()
+    double growthRate = 0;                 // daily growth fraction, applied 'days' times
+    int days = 0;
+    vector<pair<int, int>> closedRoads;    // closed in both directions
+};
+
+struct ScenarioResult {
+    string name;
+    long long routeKm = 0;
+    double cost = 0;
+    int stops = 0;
+    int yardTrips = 0;
+    int unreached = 0;       // zones to collect that the truck cannot get to
+    int overflowing = 0;     // zones at 100%
+    int critical = 0;        // zones above 80%
+    long long totalWaste = 0;
+    int changedLevels = 0;   // overlay size: levels that differ from the base version
+};
+
+/**********************************************************************************************
+CAPACITY TOURS AND THE WEEKLY COLLECTION SCHEDULE
+**********************************************************************************************/
+struct CapacityTour {
+    vector<int> path;        // zones in visiting order, start and yard stops included
+    long long km = 0;
+    int yardTrips = 0;
+    int served = 0;          // collection stops made
+    int load = 0;            // total collected
+};
+
+// Six collection days from today (the seventh is the rest day). Each zone gets a visit
+// pattern, bit i = collected on day i, chosen from forecast fill so the bin stays below 100%.
+struct WeeklySchedule {
+    static constexpr int DAYS = 6;
+
+    int calendarOffset[DAYS];          // days from today of each collection day
+    vector<int> pattern;               // per road-network zone; 0 for yards
+    vector<vector<int>> expectedFill;  // [day][zone] forecast fill when collected
+    CapacityTour tours[DAYS];
+    int atRisk = 0;                    // zones no pattern keeps below 100% (collected daily)
+    int improvements = 0;              // pattern changes accepted by the local search
+
+    long long totalKm() const {
+        long long km = 0;
+        for(const CapacityTour& t : tours) km += t.km;
+        return km;
+    }
+
+    long long busiestKm() const {
+        long long km = 0;
+        for(const CapacityTour& t : tours) km = max(km, t.km);
+        return km;
+    }
+};
+
+/**********************************************************************************************
+MAIN CLASS - WasteRoutePlanner
+**********************************************************************************************/
+class WasteRoutePlanner {
+
+private:
+
+    vector<Zone> zones;
+    unordered_map<string,int> id;
+    vector<vector<Edge>> adj;
+    int roadMaxWeight = 0;              // Largest road length; picks the shortest-path kernel
+    DistanceMatrix dist;                // Compact all-pairs road distances
+    NextHopMatrix nextHop;              // Path reconstruction for the Floyd-Warshall matrix
+    LookupTable lookupTable;
+    
+    int dumpingYard;
+    vector<int> depots;                 // All dumping yards and transfer stations
+    NearestFacilityIndex nearestDepot;  // O(1) distance to the closest depot from any zone
+    PriorityOrder priorityOrder;        // Zones by fill level, kept current by setZoneWaste()
+    FillLevelIndex fillIndex;           // Zones bucketed by waste %, kept current by setZoneWaste()
+    WasteForecaster forecaster;         // Per-zone fill forecasts, fed every new history reading
+    OverflowEtaIndex overflowEta;       // Zones by projected time to full, kept current by setZoneWaste()
+    vector<int> referenceDayWaste;
+    vector<SegmentTree*> segmentTrees;  // One per zone for history analysis
+    ContractionHierarchy ch;            // Preprocessed road graph for fast distance/path queries
+    
+    // Route history: append-only log on disk (routes.log), indexed in memory
+    RouteStore routeStore;
+
+    // Live fill-level readings; applied between menu actions, never mid-computation
+    SensorFeed sensorFeed;
+    long long sensorApplied = 0;
+    long long sensorBatches = 0;
+
+    // Published zone-state versions; other threads read these instead of 'zones'
+    EpochSnapshot<ZoneState> zoneState;
+
+public:
+
+/**********************************************************************************************
+DISPLAY ALL DRIVERS (ADMIN ONLY)
+**********************************************************************************************/
+void displayAllDrivers() {
+    system("cls");
+
+    cout << BLUE << "=============== REGISTERED DRIVERS LIST ===============\n" << RESET;
+
+    ifstream file("drivers.txt");
+
+    if (!file) {
+        cout << RED << "Error: drivers.txt file not found.\n" << RESET;
+        return;
+    }
+
+    string username, password;
+    int count = 0;
+
+    cout << left << setw(10) << "ID"
+         << setw(25) << "DRIVER USERNAME" << "\n";
+    cout << "-------------------------------------------------------\n";
+
+    while (file >> username >> password) {
+        cout << left << setw(10) << (++count)
+             << setw(25) << username << "\n";
+    }
+
+    file.close();
+
+    if (count == 0) {
+        cout << YELLOW << "No drivers registered yet.\n" << RESET;
+    }
+
+    cout << "-------------------------------------------------------\n";
+    cout << GREEN << "Total Drivers: " << count << RESET << "\n";
+}
+
+
+/**********************************************************************************************
+LOAD ZONES FROM FILE
+**********************************************************************************************/
+void loadZonesFromFile(const string& filename) {
+    ifstream file(filename);
+
+    if (!file) {
+        cout << RED << "Error: Unable to open " << filename << RESET << "\n";
+        exit(1);
+    }
+
+    zones.clear();
+    lookupTable.clear();
+    id.clear();
+
+    int zid, waste;
+    double x, y;
     string name;
 
     while (file >> zid >> name >> waste >> x >> y) {
@@ -463,19 +4746,84 @@ void loadZonesFromFile(const string& filename) {
         z.y = y;
         z.priority = waste > 80 ? 1 : (waste > 50 ? 2 : 3);
         z.history = { waste };
+        z.historyDay = WasteForecaster::today();
+
+        zones.push_back(z);
+        id[name] = zid;
+        lookupTable.insert(zid, name);
+    }
+
+    file.close();
+
+    adj.assign(zones.size(), {});
+    dumpingYard = id["DUMPING_YARD"];
+
+    cout << GREEN << "Zones loaded from file (" 
+         << zones.size() << " zones)\n" << RESET;
+}
+
+/**********************************************************************************************
+LOAD TIME WINDOWS FROM FILE (OPTIONAL: "ZONE_NAME HH:MM HH:MM SERVICE_MINUTES")
+**********************************************************************************************/
+void loadTimeWindows(const string& filename) {
+    ifstream file(filename);
+    if (!file) return;   // every zone keeps the full-shift default window
+
+    auto toShiftMinutes = [](const string& hhmm) {
+        int h = 0, m = 0;
+        char sep;
+        stringstream ss(hhmm);
+        ss >> h >> sep >> m;
+        return max(0, (h - SHIFT_START_HOUR) * 60 + m);
+    };
 
-        zones.push_back(z);
-        id[name] = zid;
-        lookupTable.insert(zid, name);
+    string name, open, close;
+    int service, loaded = 0;
+
+    while (file >> name >> open >> close >> service) {
+        if (!id.count(name)) {
+            cout << YELLOW << "Warning: time window for unknown zone " << name << RESET << "\n";
+            continue;
+        }
+        Zone& z = zones[id[name]];
+        z.windowOpen = toShiftMinutes(open);
+        z.windowClose = min(DRIVER_SHIFT_MINUTES, toShiftMinutes(close));
+        z.serviceTime = max(0, service);
+        loaded++;
     }
 
-    file.close();
+    cout << GREEN << "Time windows loaded for " << loaded << " zones\n" << RESET;
+}
 
-    adj.assign(zones.size(), {});
-    dumpingYard = id["DUMPING_YARD"];
+/**********************************************************************************************
+LOAD DEPOTS (DUMPING YARDS + TRANSFER STATIONS) FROM FILE (OPTIONAL: ONE ZONE NAME PER LINE)
+**********************************************************************************************/
+void loadDepots(const string& filename) {
+    depots.clear();
+    for(auto& z : zones) z.isDepot = false;
+
+    auto markDepot = [this](int zid) {
+        if(!zones[zid].isDepot) {
+            zones[zid].isDepot = true;
+            depots.push_back(zid);
+        }
+    };
 
-    cout << GREEN << "Zones loaded from file (" 
-         << zones.size() << " zones)\n" << RESET;
+    markDepot(dumpingYard);
+    for(auto& z : zones) {
+        if(z.name.find("DUMPING_YARD") != string::npos || z.name.find("TRANSFER_STATION") != string::npos)
+            markDepot(id[z.name]);
+    }
+
+    ifstream file(filename);
+    string name;
+    while (file >> name) {
+        if (id.count(name)) markDepot(id[name]);
+        else cout << YELLOW << "Warning: unknown depot " << name << RESET << "\n";
+    }
+
+    nearestDepot.build(adj, depots);
+    cout << GREEN << "Depots ready (" << depots.size() << " dumping yards / transfer stations)\n" << RESET;
 }
 
 /**********************************************************************************************
@@ -484,12 +4832,83 @@ CONSTRUCTOR — INITIALIZATION SEQUENCE
 WasteRoutePlanner() {
     srand(time(0));
     initCity();
+    loadTimeWindows("time_windows.txt");
+    loadDepots("depots.txt");
     referenceDayWaste.resize(zones.size());
     for(int i=0;i<zones.size();i++) {
         referenceDayWaste[i] = zones[i].currentWaste;
     }
     initSegmentTrees();
+    forecaster.fit(zones, plannerPool());
     floydWarshall();
+    initContractionHierarchy();
+    rebuildFillIndexes();
+    routeStore.open("routes.log");
+    if(routeStore.damagedRecords() > 0)
+        cout << RED << "routes.log: skipped " << routeStore.damagedRecords() << " damaged route record(s)\n" << RESET;
+    publishZoneState();
+}
+
+/**********************************************************************************************
+ZONE HISTORY — one entry per calendar day. A later reading on the same day (or, after the
+simulator has run ahead, on an earlier one) replaces the last entry, as
+WasteForecaster::observe() folds it into the same smoothing step.
+**********************************************************************************************/
+void recordDailyLevel(Zone& z, int level, int day) {
+    if(!z.history.empty() && day <= z.historyDay) {
+        z.history.back() = level;
+        return;
+    }
+    z.history.push_back(level);
+    z.historyDay = day;
+    if(z.history.size() > MAX_HISTORY_SIZE) z.history.erase(z.history.begin());
+}
+
+/**********************************************************************************************
+FILL-LEVEL UPDATES — every change to a zone's waste goes through setZoneWaste() so the
+priority order and the fill-level buckets follow it; bulk writers call rebuildFillIndexes()
+once instead
+**********************************************************************************************/
+int yardDistance(int zid) const {
+    return zid < (int)adj.size() ? nearestDepot.distance(zid) : INF;   // zones added later are off-network
+}
+
+void setZoneWaste(int zid, int waste) {
+    zones[zid].currentWaste = waste;
+    priorityOrder.update(zid, PriorityOrder::makeKey(waste, yardDistance(zid)));
+    fillIndex.update(zid, waste);
+    overflowEta.update(zid, fullDeadline(zid));
+}
+
+void rebuildFillIndexes() {
+    vector<int> keys(zones.size()), wastes(zones.size()), etas(zones.size());
+    for(int i = 0; i < (int)zones.size(); i++) {
+        keys[i] = PriorityOrder::makeKey(zones[i].currentWaste, yardDistance(i));
+        wastes[i] = zones[i].currentWaste;
+        etas[i] = fullDeadline(i);
+    }
+    priorityOrder.rebuild(keys);
+    fillIndex.build(wastes);
+    overflowEta.build(etas);
+}
+
+// Projected minutes until the bin reaches 100% at the forecast rate (0 = already full).
+// Zones without a trend yet use the fleet average as of their last update.
+int minutesToFull(int zid) const {
+    const Zone& z = zones[zid];
+    if(z.isDepot || zid >= forecaster.size()) return OverflowEtaIndex::NEVER;
+    if(z.currentWaste >= 100) return 0;
+    float perDay = forecaster.dailyGrowth(zid);
+    if(perDay <= 0) return OverflowEtaIndex::NEVER;
+    double minutes = ceil((100 - z.currentWaste) / perDay * 24 * 60);
+    return minutes >= OverflowEtaIndex::NEVER ? OverflowEtaIndex::NEVER : (int)minutes;
+}
+
+// The minute the zone is projected to be full, counted from now (its latest reading)
+int fullDeadline(int zid) const {
+    int minutes = minutesToFull(zid);
+    int at = OverflowEtaIndex::now();
+    return minutes >= OverflowEtaIndex::NEVER - at ? OverflowEtaIndex::NEVER : at + minutes;
 }
 
 /**********************************************************************************************
@@ -500,6 +4919,7 @@ void initSegmentTrees() {
     for(auto& zone : zones) {
         if(zone.history.empty()) {
             zone.history = {rand()%100, rand()%100, zone.currentWaste};
+            zone.historyDay = WasteForecaster::today();
         }
         SegmentTree* st = new SegmentTree(zone.history);
         segmentTrees.push_back(st);
@@ -579,53 +4999,107 @@ FLOYD-WARSHALL (ALL-PAIRS SHORTEST PATHS)
 **********************************************************************************************/
 void floydWarshall(){
     int n = zones.size();
-    dist.assign(n, vector<int>(n, INF));
+    vector<int> d((size_t)n * n, INF);    // working table, compressed into dist at the end
+    nextHop.reset(n);
+
+    roadMaxWeight = maxEdgeWeight(adj);
+    long long arcs = 0;
+    for(auto& edges : adj) arcs += edges.size();
+
+    // A road map is sparse: n single-source searches cost about n * (E + n), while
+    // Floyd-Warshall is n^3 whatever the density. Dense inputs keep Floyd-Warshall.
+    string method = "Floyd-Warshall";
+    if(arcs * 8 <= (long long)n * n) {
+        PathKernel kernel = choosePathKernel(roadMaxWeight);
+        method = string(pathKernelName(kernel)) + " x " + to_string(n) + " sources";
+        plannerPool().parallelFor(0, n, 4, [&](int lo, int hi) {
+            ArenaScope scope;
+            pmr::vector<int> hop(n, scratchResource());
+            for(int i = lo; i < hi; i++) {
+                shortestPaths(adj, i, roadMaxWeight, kernel, &d[(size_t)i * n], hop.data());
+                for(int j = 0; j < n; j++) nextHop.set(i, j, hop[j]);
+            }
+        });
+    } else {
+        for(int i=0;i<n;i++) {
+            d[(size_t)i*n + i] = 0;
+            nextHop.set(i, i, i);
+        }
+        for(int u=0;u<n;u++)
+            for(auto &e: adj[u])
+                if(e.weight < d[(size_t)u*n + e.to]) {
+                    d[(size_t)u*n + e.to] = e.weight;
+                    nextHop.set(u, e.to, e.to);
+                }
 
-    for(int i=0;i<n;i++) dist[i][i] = 0;
-    for(int u=0;u<n;u++)
-        for(auto &e: adj[u])
-            dist[u][e.to] = e.weight;
+        parallelFloydWarshall(d, n, &nextHop, plannerPool());
+    }
 
-    for(int k=0;k<n;k++)
-    for(int i=0;i<n;i++)
-    for(int j=0;j<n;j++)
-        if(dist[i][k] != INF && dist[k][j] != INF)
-            dist[i][j] = min(dist[i][j], dist[i][k] + dist[k][j]);
+    dist.assign(d, n);
 
-    cout << BLUE << "Distance matrix ready (Floyd-Warshall complete)" << RESET << "\n";
+    cout << BLUE << "Distance matrix ready (" << method << " complete, "
+         << (dist.isNarrow() ? "16" : "32") << "-bit cells, "
+         << fixed << setprecision(1) << (dist.memoryBytes() + nextHop.memoryBytes()) / 1024.0 << " KB)" << RESET << "\n";
 }
 
 /**********************************************************************************************
-DIJKSTRA'S ALGORITHM FOR SINGLE SOURCE SHORTEST PATH
+ROAD-LEVEL ROUTE EXPANSION
 **********************************************************************************************/
-vector<int> dijkstra(int start) {
-    int n = zones.size();
-    vector<int> distance(n, INF);
-    vector<bool> visited(n, false);
-    MinHeap pq;
-    
-    distance[start] = 0;
-    pq.push(0, start);
-    
-    while (!pq.empty()) {
-        pair<int, int> current = pq.pop();
-        int u = current.second;
-        int dist_u = current.first;
-        
-        if (visited[u]) continue;
-        visited[u] = true;
-        
-        for (auto& edge : adj[u]) {
-            int v = edge.to;
-            int weight = edge.weight;
-            
-            if (!visited[v] && dist_u + weight < distance[v]) {
-                distance[v] = dist_u + weight;
-                pq.push(distance[v], v);
-            }
+RouteRoadCursor expandRoute(const Route& route) const {
+    return RouteRoadCursor(nextHop, route.path);
+}
+
+void printRoadPath(const Route& route) {
+    RouteRoadCursor cursor = expandRoute(route);
+    int roads = 0;
+    int prev = -1;
+
+    cout << "Roads Driven: ";
+    while(!cursor.done()) {
+        int node = cursor.next();
+        if(node == -1) {
+            cout << RED << " [unreachable]" << RESET;
+            break;
         }
+        if(prev != -1) {
+            cout << " -> ";
+            roads++;
+        }
+        cout << zones[node].name;
+        prev = node;
     }
-    
+    cout << "\n" << "Road Segments: " << roads << "\n";
+}
+
+/**********************************************************************************************
+CONTRACTION HIERARCHY — LOAD FROM DISK OR REBUILD WHEN THE ROAD GRAPH CHANGED
+**********************************************************************************************/
+void initContractionHierarchy(){
+    const string filename = "ch_graph.bin";
+    uint64_t fp = ContractionHierarchy::fingerprint(adj);
+
+    if(ch.load(filename, fp) && ch.size() == (int)zones.size()) {
+        cout << BLUE << "Contraction hierarchy loaded from " << filename
+             << " (" << ch.getShortcutCount() << " shortcuts)" << RESET << "\n";
+        return;
+    }
+
+    ch.build(adj);
+    if(!ch.save(filename, fp)) {
+        cout << YELLOW << "Warning: could not write " << filename << RESET << "\n";
+    }
+    cout << BLUE << "Contraction hierarchy built (" << ch.getShortcutCount() << " shortcuts)" << RESET << "\n";
+}
+
+/**********************************************************************************************
+DIJKSTRA'S ALGORITHM FOR SINGLE SOURCE SHORTEST PATH
+The queue is picked from the longest road (Dial's buckets for short roads, radix heap
+otherwise). The result lives in 'mem', the thread's scratch arena by default, so callers
+keep an ArenaScope open for as long as they use the distances.
+**********************************************************************************************/
+pmr::vector<int> dijkstra(int start, pmr::memory_resource* mem = scratchResource()) {
+    pmr::vector<int> distance(zones.size(), INF, mem);   // zones added later stay unreachable
+    shortestPaths(adj, start, roadMaxWeight, choosePathKernel(roadMaxWeight), distance.data());
     return distance;
 }
 
@@ -672,6 +5146,8 @@ void prioritySort(){
     cout << "2. Merge Sort (Stable sorting)\n";
     cout << "3. Standard Sort (STL)\n";
     cout << "4. Heap-based Priority Queue\n";
+    cout << "5. Counting Sort (O(N), waste is 0-100)\n";
+    cout << "6. Live Priority Order (waste, then km to nearest yard)\n";
     cout << "Enter choice: ";
     
     int choice;
@@ -698,6 +5174,15 @@ void prioritySort(){
             prioritySortHeap(v);
             cout << MAGENTA << "PRIORITY ORDER (Heap - High to Low Waste)\n" << RESET;
             break;
+        case 5:
+            SortingAlgorithms::countingSort(v, 0, v.size() - 1);
+            cout << MAGENTA << "PRIORITY ORDER (Counting Sort - High to Low Waste)\n" << RESET;
+            break;
+        case 6:
+            v.clear();
+            for(int zid : priorityOrder.zonesInOrder()) v.push_back(zones[zid]);
+            cout << MAGENTA << "PRIORITY ORDER (Live Index - High Waste, Then Nearest to Yard)\n" << RESET;
+            break;
         default:
             SortingAlgorithms::quickSort(v, 0, v.size() - 1, true);
             cout << MAGENTA << "PRIORITY ORDER (Quick Sort - High to Low Waste)\n" << RESET;
@@ -747,8 +5232,16 @@ void prioritySortHeap(vector<Zone>& result) {
 }
 
 /**********************************************************************************************
-PREDICT NEXT DAY WASTE USING SEGMENT TREE AND DP
+PREDICT NEXT DAY WASTE — HOLT-WINTERS FORECAST PER ZONE
 **********************************************************************************************/
+// Expected fill of every zone 'days' from now (0 = today's readings)
+vector<int> forecastFill(int days) {
+    vector<int> current(zones.size()), expected(zones.size());
+    for(int i = 0; i < (int)zones.size(); i++) current[i] = zones[i].currentWaste;
+    forecaster.forecastAll(days, current.data(), expected.data());
+    return expected;
+}
+
 void predictWaste(){
     cin.ignore(numeric_limits<streamsize>::max(), '\n');
 
@@ -781,115 +5274,118 @@ void predictWaste(){
         selected = matches[c-1];
     }
 
-    // Enhanced prediction using Segment Tree and DP-style recurrence
-    Zone& zone = zones[selected];
-    
-    // Calculate trend from history using segment tree
-    if(segmentTrees[selected] != nullptr && zone.history.size() > 1) {
-        int maxRecent = segmentTrees[selected]->getMax();
-        int avgRecent = accumulate(zone.history.begin(), zone.history.end(), 0) / zone.history.size();
-        
-        // DP-style recurrence: next = weighted average + trend
-        int trend = zone.currentWaste - (zone.history.size() > 1 ? zone.history[zone.history.size()-2] : zone.currentWaste);
-        int nextPrediction = min(100, max(0, zone.currentWaste + trend + (rand()%20 - 10)));
-        
-        // Update history
-        zone.history.push_back(nextPrediction);
-        if(zone.history.size() > MAX_HISTORY_SIZE) {
-            zone.history.erase(zone.history.begin());
-        }
-        
-        // Update segment tree
-        delete segmentTrees[selected];
-        segmentTrees[selected] = new SegmentTree(zone.history);
-        
-        cout << GREEN << "\n========== PREDICTION RESULTS ==========\n" << RESET;
-        cout << "Zone: " << zone.name << "\n";
-        cout << "Current Waste: " << zone.currentWaste << "%\n";
-        cout << "Max Recent: " << maxRecent << "%\n";
-        cout << "Average Recent: " << avgRecent << "%\n";
-        cout << "Predicted for Tomorrow: " << nextPrediction << "%\n";
-        cout << "Trend: " << (trend > 0 ? "+" : "") << trend << "%\n";
-        cout << "==========================================\n" << RESET;
-    } else {
-        // Simple prediction if no history
-        int nextPrediction = min(100, zone.currentWaste + (rand()%30 + 10));
-        zone.history.push_back(nextPrediction);
-        cout << GREEN << "Predicted waste for tomorrow at "
-             << zone.name << " = "
-             << nextPrediction << "%" << RESET << "\n";
+    // Forecast from the zone's smoothed model; the forecast is not a reading, so history
+    // is left alone
+    const Zone& zone = zones[selected];
+    int nextPrediction = forecaster.forecast(selected, zone.currentWaste, 1);
+
+    cout << GREEN << "\n========== PREDICTION RESULTS ==========\n" << RESET;
+    cout << "Zone: " << zone.name << "\n";
+    cout << "Current Waste: " << zone.currentWaste << "%\n";
+    if(selected < (int)segmentTrees.size() && segmentTrees[selected] != nullptr && !zone.history.empty()) {
+        cout << "Max Recent: " << segmentTrees[selected]->getMax() << "%\n";
+        cout << "Average Recent: " << accumulate(zone.history.begin(), zone.history.end(), 0) / (int)zone.history.size() << "%\n";
+    }
+    cout << "Predicted for Tomorrow: " << nextPrediction << "%\n";
+    float trend = forecaster.trendOf(selected);
+    cout << "Trend: " << (trend > 0 ? "+" : "") << fixed << setprecision(1) << trend << "% per day"
+         << " (" << forecaster.readings(selected) << " readings)\n";
+    if(forecaster.readings(selected) >= WasteForecaster::SEASON) {
+        float offset = forecaster.seasonalOffset(selected, 1);
+        cout << "Weekly Pattern Tomorrow: " << (offset > 0 ? "+" : "") << offset << "%\n";
     }
+
+    cout << "7-Day Outlook:";
+    for(int d = 1; d <= 7; d++) cout << " " << forecaster.forecast(selected, zone.currentWaste, d) << "%";
+    cout << "\n==========================================\n" << RESET;
 }
 
 /**********************************************************************************************
 BFS SPREAD MODEL — EACH BFS LAYER ADDS 10% WASTE
 **********************************************************************************************/
+// Hop levels from every origin at once (-1 = unreachable, zones added later included);
+// read-only, so what-if callers can run it without touching the live zones
+vector<int> spreadLevels(const vector<int>& origins) {
+    vector<int> level(zones.size(), -1);
+    multiSourceBfs(adj, origins, level.data(), plannerPool());
+    return level;
+}
+
 void bfsSpread(){
     cin.ignore(numeric_limits<streamsize>::max(), '\n');
 
-    cout << CYAN << "Enter starting zone for BFS spread (partial/full): " << RESET;
+    cout << CYAN << "Enter starting zone(s) for BFS spread (partial/full, comma separated): " << RESET;
     string input;
     getline(cin, input);
 
     for(char &c : input) c = toupper(c);
 
-    vector<int> matches = lookupTable.findAllMatches(input);
+    vector<int> origins;
+    stringstream tokens(input);
+    string token;
+    while(getline(tokens, token, ',')) {
+        token.erase(0, token.find_first_not_of(' '));
+        token.erase(token.find_last_not_of(' ') + 1);
+        if(token.empty()) continue;
 
-    if(matches.empty()){
-        cout << RED << "No matching zone found. Try again.\n" << RESET;
-        cout << YELLOW << "Available zones:\n" << RESET;
-        for(auto &z : zones) cout << " - " << z.name << "\n";
-        return;
-    }
+        vector<int> matches = lookupTable.findAllMatches(token);
 
-    int start;
+        if(matches.empty()){
+            cout << RED << "No matching zone found for " << token << ". Try again.\n" << RESET;
+            cout << YELLOW << "Available zones:\n" << RESET;
+            for(auto &z : zones) cout << " - " << z.name << "\n";
+            return;
+        }
 
-    if(matches.size() > 1){
-        cout << YELLOW << "\nMultiple matches found:\n" << RESET;
-        for(int i=0; i<matches.size(); i++)
-            cout << "(" << i+1 << ") " << zones[matches[i]].name << "\n";
+        int start;
 
-        cout << CYAN << "Select number: " << RESET;
-        int c; cin >> c;
+        if(matches.size() > 1){
+            cout << YELLOW << "\nMultiple matches found:\n" << RESET;
+            for(int i=0; i<(int)matches.size(); i++)
+                cout << "(" << i+1 << ") " << zones[matches[i]].name << "\n";
 
-        if(c < 1 || c > matches.size()){
-            cout << RED << "Invalid choice.\n" << RESET;
-            return;
-        }
+            cout << CYAN << "Select number: " << RESET;
+            int c; cin >> c;
+
+            if(c < 1 || c > (int)matches.size()){
+                cout << RED << "Invalid choice.\n" << RESET;
+                return;
+            }
 
-        start = matches[c-1];
+            start = matches[c-1];
+        }
+        else {
+            start = matches[0];
+        }
+        origins.push_back(start);
     }
-    else {
-        start = matches[0];
+
+    if(origins.empty()){
+        cout << RED << "No starting zone given.\n" << RESET;
+        return;
     }
 
-    vector<int> level(zones.size(), -1);
-    queue<int> q;
-    q.push(start);
-    level[start] = 0;
+    vector<int> level = spreadLevels(origins);
 
-    cout << BLUE << "\nApplying BFS waste spread from: "
-         << zones[start].name << RESET << "\n";
+    cout << BLUE << "\nApplying BFS waste spread from: ";
+    for(int i = 0; i < (int)origins.size(); i++)
+        cout << (i ? ", " : "") << zones[origins[i]].name;
+    cout << RESET << "\n";
+
+    // Report nearest rings first, zone order within a ring
+    vector<int> reached;
+    for(int u = 0; u < (int)zones.size(); u++)
+        if(level[u] > 0) reached.push_back(u);
+    stable_sort(reached.begin(), reached.end(), [&](int a, int b) { return level[a] < level[b]; });
 
     vector<int> affectedZones;
     
-    while(!q.empty()){
-        int u = q.front(); q.pop();
-
-        if(level[u] > 0){
-            int increase = level[u] * 10;
-            int oldWaste = zones[u].currentWaste;
-            zones[u].currentWaste = min(100, zones[u].currentWaste + increase);
-            if(zones[u].currentWaste != oldWaste) {
-                affectedZones.push_back(u);
-            }
-        }
-
-        for(auto &e : adj[u]){
-            if(level[e.to] == -1){
-                level[e.to] = level[u] + 1;
-                q.push(e.to);
-            }
+    for(int u : reached){
+        int increase = level[u] * 10;
+        int oldWaste = zones[u].currentWaste;
+        setZoneWaste(u, min(100, zones[u].currentWaste + increase));
+        if(zones[u].currentWaste != oldWaste) {
+            affectedZones.push_back(u);
         }
     }
 
@@ -904,8 +5400,161 @@ void bfsSpread(){
 }
 
 /**********************************************************************************************
-WEEKLY PLAN — SIMULATE 7 DAY GROWTH
+WEEKLY PLAN — FORECAST-DRIVEN PERIODIC SCHEDULE OVER THE NEXT SIX COLLECTION DAYS
+Each zone gets the fewest visits that keep its forecast fill below 100% through the week and
+into the next one. Among those visit patterns, a local search moves zones between days to cut
+total truck-km plus the busiest day's km, so the week is balanced; each candidate's affected
+days are re-routed in parallel with the same capacity tour used everywhere else.
 **********************************************************************************************/
+WeeklySchedule planWeek() {
+    static constexpr int DAYS = WeeklySchedule::DAYS;
+    static constexpr int MAX_PASSES = 4;
+
+    WeeklySchedule w;
+    int n = adj.size();
+    time_t now = time(0);
+    int todayIndex = (localtime(&now)->tm_wday + 6) % 7;   // Monday = 0, Sunday = 6
+    for(int k = 0, i = 0; k < 7; k++)
+        if((todayIndex + k) % 7 != 6) w.calendarOffset[i++] = k;
+
+    // Zones with no measured trend yet grow at the fleet average
+    float fallback = forecaster.averageGrowth();
+
+    // growth[z][k]: expected rise on calendar day k (1..7); never negative between visits
+    vector<array<float, 8>> growth(n);
+    for(int z = 0; z < n; z++)
+        for(int k = 1; k <= 7; k++)
+            growth[z][k] = forecaster.hasTrend(z)
+                         ? max(0.0f, forecaster.growth(z, k) - forecaster.growth(z, k - 1)) : fallback;
+
+    // Morning fill on each calendar day, a visit empties the bin. Feasible when no morning
+    // fill reaches 100% this week, nor before the pattern's first visit comes round again.
+    auto simulate = [&](int z, int mask, int* collected) {
+        float fill = zones[z].currentWaste, weekGrowth = 0;
+        for(int k = 1; k <= 7; k++) weekGrowth += growth[z][k];
+        bool ok = mask != 0;
+        for(int k = 0, day = 0; k < 7; k++) {
+            if(k > 0) {                       // today's reading is a given, full or not
+                fill += growth[z][k];
+                if(fill >= 100) ok = false;
+            }
+            if(day < DAYS && w.calendarOffset[day] == k) {
+                if(mask >> day & 1) {
+                    if(collected) collected[day] = WasteForecaster::clampPercent(fill);
+                    fill = 0;
+                }
+                day++;
+            }
+        }
+        if(mask) {
+            int nextFirst = w.calendarOffset[__builtin_ctz(mask)] + 7;
+            if(fill + weekGrowth / 7 * (nextFirst - 6) >= 100) ok = false;
+        }
+        return ok;
+    };
+
+    // Candidate patterns per zone: every feasible pattern with the fewest visits
+    vector<vector<int>> candidates(n);
+    w.pattern.assign(n, 0);
+    for(int z = 0; z < n; z++) {
+        if(zones[z].isDepot) continue;
+        int fewest = DAYS + 1;
+        for(int mask = 1; mask < (1 << DAYS); mask++) {
+            int visits = __builtin_popcount(mask);
+            if(visits > fewest || !simulate(z, mask, nullptr)) continue;
+            if(visits < fewest) candidates[z].clear();
+            fewest = visits;
+            candidates[z].push_back(mask);
+        }
+        if(candidates[z].empty()) {
+            candidates[z].push_back((1 << DAYS) - 1);   // overflows whatever we do: every day
+            w.atRisk++;
+        }
+    }
+
+    // Start balanced by stop count: most constrained zones first, each on its lightest days
+    vector<int> order;
+    for(int z = 0; z < n; z++)
+        if(!candidates[z].empty()) order.push_back(z);
+    stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return candidates[a].size() < candidates[b].size();
+    });
+    int stops[DAYS] = {};
+    for(int z : order) {
+        int best = candidates[z][0], bestPeak = INT_MAX;
+        for(int mask : candidates[z]) {
+            int peak = 0;
+            for(int d = 0; d < DAYS; d++)
+                if(mask >> d & 1) peak = max(peak, stops[d] + 1);
+            if(peak < bestPeak) bestPeak = peak, best = mask;
+        }
+        w.pattern[z] = best;
+        for(int d = 0; d < DAYS; d++) stops[d] += best >> d & 1;
+    }
+
+    w.expectedFill.assign(DAYS, vector<int>(n, 0));
+    auto applyPattern = [&](int z, int mask) {
+        int collected[DAYS] = {};
+        w.pattern[z] = mask;
+        simulate(z, mask, collected);
+        for(int d = 0; d < DAYS; d++) w.expectedFill[d][z] = (mask >> d & 1) ? collected[d] : 0;
+    };
+    for(int z : order) applyPattern(z, w.pattern[z]);
+
+    int start = routeStartZone();
+    auto buildDays = [&](int dayMask, CapacityTour* out) {
+        plannerPool().parallelFor(0, DAYS, 1, [&](int lo, int hi) {
+            for(int d = lo; d < hi; d++) {
+                if(!(dayMask >> d & 1)) continue;
+                VisitedMask open(n);
+                for(int z = 0; z < n; z++)
+                    if(!(w.pattern[z] >> d & 1)) open.set(z);
+                out[d] = capacityTour(start, open, w.expectedFill[d],
+                                      [this](int u, int* row) { matrixRow(u, row); });
+            }
+        });
+    };
+    auto objective = [](const CapacityTour* t) {
+        long long total = 0, peak = 0;
+        for(int d = 0; d < DAYS; d++) {
+            total += t[d].km;
+            peak = max(peak, t[d].km);
+        }
+        return total + peak;
+    };
+
+    buildDays((1 << DAYS) - 1, w.tours);
+    long long current = objective(w.tours);
+
+    // First-improvement local search over each zone's alternative patterns
+    CapacityTour trial[DAYS];
+    for(int pass = 0; pass < MAX_PASSES; pass++) {
+        bool improved = false;
+        for(int z : order) {
+            if(candidates[z].size() < 2) continue;
+            for(int mask : candidates[z]) {
+                int old = w.pattern[z];
+                if(mask == old) continue;
+
+                applyPattern(z, mask);
+                copy(w.tours, w.tours + DAYS, trial);
+                buildDays(old | mask, trial);
+                long long cost = objective(trial);
+                if(cost < current) {
+                    current = cost;
+                    copy(trial, trial + DAYS, w.tours);
+                    w.improvements++;
+                    improved = true;
+                } else {
+                    applyPattern(z, old);
+                }
+            }
+        }
+        if(!improved) break;
+    }
+    return w;
+}
+
 void weeklyPlan(){
     cin.ignore(numeric_limits<streamsize>::max(), '\n');
 
@@ -942,46 +5591,49 @@ void weeklyPlan(){
         return;
     }
 
-    cout << left << setw(30) << "ZONE"
+    WeeklySchedule week = planWeek();
+    time_t now = time(0);
+    int todayIndex = (localtime(&now)->tm_wday + 6) % 7;
+    int selected = 0;
+
+    cout << left << setw(12) << "DAY" << setw(8) << "STOPS" << setw(10) << "KM" << "YARD TRIPS\n";
+    cout << "--------------------------------------------------------------\n";
+    for(int d = 0; d < WeeklySchedule::DAYS; d++) {
+        int weekday = (todayIndex + week.calendarOffset[d]) % 7;
+        if(weekday == dayIndex) selected = d;
+        cout << (weekday == dayIndex ? CYAN : RESET) << left << setw(12) << days[weekday]
+             << setw(8) << week.tours[d].served << setw(10) << week.tours[d].km
+             << week.tours[d].yardTrips << RESET << "\n";
+    }
+    cout << "--------------------------------------------------------------\n";
+    cout << "Week total: " << week.totalKm() << " km, busiest day " << week.busiestKm() << " km"
+         << " (" << week.improvements << " rebalancing moves)\n";
+    if(week.atRisk > 0)
+        cout << RED << week.atRisk << " zone(s) fill faster than any schedule can keep below 100%; collected daily.\n" << RESET;
+
+    cout << "\n" << left << setw(30) << "ZONE"
          << setw(10) << "COLOR"
          << "WASTE\n";
     cout << "--------------------------------------------------------------\n";
 
+    const CapacityTour& tour = week.tours[selected];
+    const vector<int>& fill = week.expectedFill[selected];
     bool any = false;
 
-    for(int i=0;i<zones.size();i++){
-        int w = zones[i].currentWaste;
-        bool visit = false;
-        string color = GREEN;
-
-        if(w > 50){
-            visit = true;
-            color = RED;
-        }
-        else if(w >= 30 && w <= 50){
-            if(dayIndex % 2 == 0){
-                visit = true;
-                color = YELLOW;
-            }
-        }
-        else if(w < 30){
-            if(dayIndex == 0 || dayIndex == 3){
-                visit = true;
-                color = GREEN;
-            }
-        }
-
-        if(visit){
-            any = true;
-            cout << left << setw(30)
-                 << zones[i].name;
-
-            if(color == RED) cout << RED   << setw(10) << "RED"    << RESET;
-            if(color == YELLOW) cout << YELLOW << setw(10) << "YELLOW" << RESET;
-            if(color == GREEN) cout << GREEN << setw(10) << "GREEN"  << RESET;
-
-            cout << w << "%\n";
+    for(int i = 0; i < (int)tour.path.size(); i++){
+        int z = tour.path[i];
+        if(i == 0 && !(week.pattern[z] >> selected & 1)) continue;   // start, nothing to collect
+        if(zones[z].isDepot){
+            cout << RED << "  -> Unload at " << zones[z].name << RESET << "\n";
+            continue;
         }
+        any = true;
+        int w = fill[z];
+        cout << left << setw(30) << zones[z].name;
+        if(w > 50) cout << RED << setw(10) << "RED" << RESET;
+        else if(w >= 30) cout << YELLOW << setw(10) << "YELLOW" << RESET;
+        else cout << GREEN << setw(10) << "GREEN" << RESET;
+        cout << w << "%\n";
     }
 
     if(!any){
@@ -1082,21 +5734,37 @@ void tspLite(){
         start = match[c-1];
     }
 
-    vector<int> vis(zones.size(),0), route;
-    vis[start]=1; route.push_back(start);
+    ArenaScope scope;
+    VisitedMask vis(zones.size(), scratchResource());
+    vector<int> route;
+    route.reserve(zones.size());
+    vis.set(start); route.push_back(start);
     int cur = start;
     int totalDist = 0;
 
     while(true){
-        int nxt=-1, best=INF;
-        for(int i=0;i<zones.size();i++)
-            if(!vis[i] && dist[cur][i]<best)
-                best = dist[cur][i], nxt=i;
+        int best;
+        int nxt = nearestUnvisited(dist[cur], vis, best);
         if(nxt==-1) break;
         totalDist += best;
-        vis[nxt]=1; route.push_back(nxt); cur=nxt;
+        vis.set(nxt); route.push_back(nxt); cur=nxt;
     }
 
+    // Refine the greedy order with the tour improvement engine (time bounded)
+    int greedyDist = totalDist;
+    TourImprover improver(dist, route);
+    vector<int> order(route.size());
+    iota(order.begin(), order.end(), 0);
+    TourImprover::Result refined = improver.improve(order, 1.0, 50 * (int)route.size());
+    int lowerBound = improver.lowerBound(0.5);
+
+    vector<int> improvedRoute;
+    for(int idx : refined.tour) improvedRoute.push_back(route[idx]);
+    route = improvedRoute;
+    Route savedRoute = evaluateRoute(route);
+    totalDist = savedRoute.totalDistance;
+    cur = route.back();
+
     cout << BLUE << "\n=================== TSP-LITE ROUTE ===================\n" << RESET;
     cout << left << setw(6) << "STOP" << setw(COLUMN_WIDTH) << "LOCATION" << "DIST FROM PREV\n";
     cout << "--------------------------------------------------------------\n";
@@ -1116,20 +5784,74 @@ void tspLite(){
     cout << "FINISH AT        : " << zones[cur].name << "\n";
     cout << "STOPS COVERED    : " << route.size() << "\n";
     cout << "TOTAL DISTANCE   : " << totalDist << " km\n";
+    cout << "GREEDY DISTANCE  : " << greedyDist << " km (before 2-opt/Or-opt refinement)\n";
+    cout << "LOWER BOUND      : " << lowerBound << " km (1-tree)\n";
+    cout << "OPTIMALITY GAP   : " << fixed << setprecision(2)
+         << (lowerBound > 0 ? 100.0 * (totalDist - lowerBound) / lowerBound : 0.0) << "%\n";
     
-    double cost = (totalDist / TRUCK_MILEAGE) * FUEL_PRICE;
-    cout << "ESTIMATED COST   : Rs. " << fixed << setprecision(2) << cost << "\n";
+    cout << "ESTIMATED COST   : Rs. " << fixed << setprecision(2) << savedRoute.totalCost << "\n";
     cout << "==============================================================\n";
     
-    // Save route for comparison
-    Route savedRoute;
-    savedRoute.path = route;
-    savedRoute.totalDistance = totalDist;
-    savedRoute.totalCost = cost;
-    for(int zid : route) {
-        savedRoute.totalWaste += zones[zid].currentWaste;
+    // Save route for comparison (kept across restarts in routes.log)
+    printRoadPath(savedRoute);
+    routeStore.append(savedRoute, RouteStore::today(), currentUser);
+}
+
+/**********************************************************************************************
+TIME-WINDOW & SHIFT AWARE ROUTE (CHEAPEST FEASIBLE INSERTION + REMOVE/REINSERT IMPROVEMENT)
+**********************************************************************************************/
+vector<int> timeWindowRoute(int start, const vector<int>& candidates, vector<int>& unassigned) {
+    TimeWindowSchedule schedule(zones, dist, start);
+    unassigned.clear();
+
+    // Fullest zones claim shift time first
+    vector<int> order = candidates;
+    stable_sort(order.begin(), order.end(), [this](int a, int b) {
+        return zones[a].currentWaste > zones[b].currentWaste;
+    });
+
+    for(int z : order) {
+        if(z == start) continue;
+        int extra;
+        int pos = schedule.bestInsertion(z, extra);
+        if(pos == -1) unassigned.push_back(z);
+        else schedule.insert(pos, z);
+    }
+
+    // Remove/reinsert passes: move a stop to its cheapest feasible slot while that saves km
+    bool improved = true;
+    for(int pass = 0; pass < 5 && improved; pass++) {
+        improved = false;
+        for(int i = 1; i < (int)schedule.stops().size(); i++) {
+            int z = schedule.stops()[i];
+            int before = schedule.totalDistance();
+            schedule.removeAt(i);
+
+            int extra;
+            int pos = schedule.bestInsertion(z, extra);
+            schedule.insert(pos == -1 ? i - 1 : pos, z);
+            if(schedule.totalDistance() < before) improved = true;
+        }
+    }
+
+    // Zones left over might still fit in gaps opened by the improvement passes
+    vector<int> stillLeft;
+    for(int z : unassigned) {
+        int extra;
+        int pos = schedule.bestInsertion(z, extra);
+        if(pos == -1) stillLeft.push_back(z);
+        else schedule.insert(pos, z);
     }
-    savedRoutes.push_back(savedRoute);
+    unassigned = stillLeft;
+
+    return schedule.stops();
+}
+
+static string shiftClock(int minutes) {
+    int total = SHIFT_START_HOUR * 60 + minutes;
+    char buf[8];
+    snprintf(buf, sizeof(buf), "%02d:%02d", (total / 60) % 24, total % 60);
+    return buf;
 }
 
 /**********************************************************************************************
@@ -1140,18 +5862,127 @@ void driversRoute(){
 
     cout << BLUE << "\n=============== DRIVER ROUTE PLANNING ===============\n" << RESET;
 
+    cout << CYAN << "Routing mode:\n" << RESET;
+    cout << "1. Standard (zone order; nearest stop next when split into districts)\n";
+    cout << "2. Time-window & shift aware (" << DRIVER_SHIFT_MINUTES / 60 << "h shift cap)\n";
+    cout << "Enter choice: ";
+    int mode;
+    cin >> mode;
+
+    cout << CYAN << "Number of trucks (one district each, 1 = single driver): " << RESET;
+    int trucks;
+    cin >> trucks;
+    trucks = max(1, min(trucks, (int)zones.size()));
+
     vector<int> todayRoute;
     vector<int> tomorrowRoute;
 
-    for(auto &z : zones){
-        if(z.currentWaste >= 50) todayRoute.push_back(z.id);
-        else tomorrowRoute.push_back(z.id);
-    }
+    fillIndex.atLeast(50, todayRoute);
+    fillIndex.inRange(0, 49, tomorrowRoute);
+
+    // Below 50% now but forecast critical by tomorrow: collect today instead
+    vector<int> tomorrowFill = forecastFill(1);
+    int pulledForward = 0;
+    for(int z : tomorrowRoute)
+        if(tomorrowFill[z] > 80) {
+            todayRoute.push_back(z);
+            pulledForward++;
+        }
+    tomorrowRoute.erase(remove_if(tomorrowRoute.begin(), tomorrowRoute.end(),
+                                  [&](int z) { return tomorrowFill[z] > 80; }),
+                        tomorrowRoute.end());
+
+    sort(todayRoute.begin(), todayRoute.end());        // standard mode visits in zone order
+    sort(tomorrowRoute.begin(), tomorrowRoute.end());
 
-    int current = id["AZAM_NAGAR_CIRCLE"];
+    int routeStart = id["AZAM_NAGAR_CIRCLE"];
     int totalKm = 0;
 
+    // Pre-pass: one district per truck, balanced on tomorrow's expected waste and road km.
+    // Each truck starts from its district's centre.
+    vector<vector<int>> truckStops(1, todayRoute);
+    vector<int> truckStart(1, routeStart);
+    TerritoryPartitioner territories;
+    if(trucks > 1){
+        int n = adj.size();
+        vector<int> weight(n);
+        for(int z = 0; z < n; z++) weight[z] = max(1, tomorrowFill[z]);
+        territories.partition(adj, weight, trucks, routeStart);
+        truckStops.assign(territories.count(), {});
+        truckStart.resize(territories.count());
+        for(int d = 0; d < territories.count(); d++) truckStart[d] = territories.medoid(d);
+
+        vector<int> unassigned;          // zones added after the road network was built
+        for(int z : todayRoute) {
+            if(z >= n) unassigned.push_back(z);
+            else truckStops[territories.district(z)].push_back(z);
+        }
+
+        // Standard mode: nearest stop next from the centre
+        for(int d = 0; d < (int)truckStops.size(); d++){
+            if(mode == 2 || truckStops[d].empty()) continue;
+            vector<int> targets = truckStops[d];
+            bool servesStart = find(targets.begin(), targets.end(), truckStart[d]) != targets.end();
+            Route greedy = optimizedRouteGreedy(truckStart[d], targets);
+            truckStops[d].assign(greedy.path.begin() + (servesStart ? 0 : 1), greedy.path.end());
+            unassigned.insert(unassigned.end(), targets.begin(), targets.end());   // unreachable
+        }
+
+
+        cout << MAGENTA << "\nDISTRICTS (" << territories.count() << " trucks, "
+             << territories.rounds() << " balancing round(s))\n" << RESET;
+        cout << left << setw(8) << "TRUCK" << setw(COLUMN_WIDTH) << "CENTRE" << setw(8) << "ZONES"
+             << setw(10) << "WASTE" << setw(10) << "ROAD KM" << "STOPS TODAY\n";
+        for(int d = 0; d < territories.count(); d++){
+            cout << left << setw(8) << d + 1 << setw(COLUMN_WIDTH) << zones[territories.medoid(d)].name
+                 << setw(8) << territories.zoneCount(d) << setw(10) << territories.waste(d)
+                 << setw(10) << territories.treeKm(d) << truckStops[d].size() << "\n";
+        }
+        cout << "Heaviest district: " << fixed << setprecision(2) << territories.imbalance() << "x the average load\n";
+        if(!unassigned.empty()){
+            cout << YELLOW << unassigned.size() << " zone(s) are not on any district's roads and move to tomorrow.\n" << RESET;
+            tomorrowRoute.insert(tomorrowRoute.begin(), unassigned.begin(), unassigned.end());
+        }
+    }
+
+    if(mode == 2){
+        vector<int> deferred;
+        for(int t = 0; t < (int)truckStops.size(); t++){
+            if(truckStops.size() > 1 && truckStops[t].empty()) continue;
+            int start = truckStart[t];
+            bool servesStart = find(truckStops[t].begin(), truckStops[t].end(), start) != truckStops[t].end();
+            vector<int> unfit;
+            vector<int> planned = timeWindowRoute(start, truckStops[t], unfit);
+            truckStops[t].assign(planned.begin() + (servesStart ? 0 : 1), planned.end());
+            deferred.insert(deferred.end(), unfit.begin(), unfit.end());
+
+            TimeWindowSchedule schedule(zones, dist, start);
+            for(int z : truckStops[t])
+                if(z != start) schedule.insert(schedule.stops().size() - 1, z);
+
+            cout << MAGENTA << "\nSHIFT SCHEDULE" << (truckStops.size() > 1 ? " - TRUCK " + to_string(t + 1) : "")
+                 << " (start " << shiftClock(0) << ", cap " << shiftClock(DRIVER_SHIFT_MINUTES) << ")\n" << RESET;
+            cout << left << setw(COLUMN_WIDTH) << "LOCATION" << setw(10) << "SERVICE" << "WINDOW\n";
+            for(int i = 1; i < (int)schedule.stops().size(); i++){
+                const Zone& z = zones[schedule.stops()[i]];
+                cout << left << setw(COLUMN_WIDTH) << z.name
+                     << setw(10) << shiftClock(schedule.serviceStart(i))
+                     << shiftClock(z.windowOpen) << "-" << shiftClock(z.windowClose) << "\n";
+            }
+            cout << "Shift ends at " << shiftClock(schedule.finishTime()) << "\n";
+        }
+
+        if(!deferred.empty()){
+            cout << YELLOW << deferred.size() << " zone(s) do not fit today's windows/shift and move to tomorrow.\n" << RESET;
+            tomorrowRoute.insert(tomorrowRoute.begin(), deferred.begin(), deferred.end());
+        }
+    }
+    todayRoute.clear();
+    for(auto& stops : truckStops) todayRoute.insert(todayRoute.end(), stops.begin(), stops.end());
+
     cout << RED << "\nTODAY'S ROUTE (Waste >= 50%)\n" << RESET;
+    if(pulledForward > 0)
+        cout << RED << pulledForward << " zone(s) below 50% are forecast above 80% by tomorrow and are included.\n" << RESET;
     cout << RED << "--------------------------------------------------------------\n" << RESET;
     cout << BOLD << left << setw(6) << "STOP" << setw(COLUMN_WIDTH) << "LOCATION" << "DISTANCE" << RESET << "\n";
     cout << RED << "--------------------------------------------------------------\n" << RESET;
@@ -1159,16 +5990,22 @@ void driversRoute(){
     if(todayRoute.empty()){
         cout << GREEN << "No locations require visit today.\n" << RESET;
     } else {
-        int stop = 1;
-        for(int z : todayRoute){
-            int km = dist[current][z];
-            totalKm += km;
-
-            cout << RED << "[" << stop++ << "] " << RESET
-                 << left << setw(COLUMN_WIDTH) << zones[z].name
-                 << km << " km\n";
-
-            current = z;
+        for(int t = 0; t < (int)truckStops.size(); t++){
+            if(truckStops.size() > 1)
+                cout << BOLD << "TRUCK " << t + 1 << " from " << zones[truckStart[t]].name
+                     << " (" << truckStops[t].size() << " stops)" << RESET << "\n";
+            int stop = 1;
+            int current = truckStart[t];
+            for(int z : truckStops[t]){
+                int km = dist[current][z];
+                totalKm += km;
+
+                cout << RED << "[" << stop++ << "] " << RESET
+                     << left << setw(COLUMN_WIDTH) << zones[z].name
+                     << km << " km\n";
+
+                current = z;
+            }
         }
     }
 
@@ -1176,7 +6013,7 @@ void driversRoute(){
 
     cout << YELLOW << "\nTOMORROW'S ROUTE (Waste < 50%)\n" << RESET;
     cout << YELLOW << "--------------------------------------------------------------\n" << RESET;
-    cout << BOLD << left << setw(6) << "STOP" << setw(COLUMN_WIDTH) << "LOCATION" << RESET << "\n";
+    cout << BOLD << left << setw(6) << "STOP" << setw(COLUMN_WIDTH) << "LOCATION" << "FORECAST" << RESET << "\n";
     cout << YELLOW << "--------------------------------------------------------------\n" << RESET;
 
     if(tomorrowRoute.empty()){
@@ -1185,7 +6022,7 @@ void driversRoute(){
         int stop = 1;
         for(int z : tomorrowRoute){
             cout << YELLOW << "[" << stop++ << "] " << RESET
-                 << left << setw(COLUMN_WIDTH) << zones[z].name << "\n";
+                 << left << setw(COLUMN_WIDTH) << zones[z].name << tomorrowFill[z] << "%\n";
         }
     }
 
@@ -1201,7 +6038,16 @@ void driversRoute(){
     cin >> collect;
 
     if(collect == 'y' || collect == 'Y'){
-        for(int z : todayRoute) zones[z].currentWaste = 0;
+        // Log each driven route (waste measured before the bins are emptied)
+        for(int t = 0; t < (int)truckStops.size(); t++){
+            if(truckStops[t].empty()) continue;
+            vector<int> driven(1, truckStart[t]);
+            for(int z : truckStops[t])
+                if(z != truckStart[t]) driven.push_back(z);
+            routeStore.append(evaluateRoute(driven), RouteStore::today(), currentUser);
+        }
+
+        for(int z : todayRoute) setZoneWaste(z, 0);
 
         double fuelUsed = double(totalKm) / TRUCK_MILEAGE;
         double cost = fuelUsed * FUEL_PRICE;
@@ -1223,54 +6069,127 @@ void driversRoute(){
 /**********************************************************************************************
 CAPACITY ROUTE — TRUCK RETURNS TO DUMPING YARD AT 200 UNITS
 **********************************************************************************************/
-void capacityRoute(){
-    int cur = id["AZAM_NAGAR_CIRCLE"];
+// Where every planned route starts
+int routeStartZone() const {
+    auto start = id.find("AZAM_NAGAR_CIRCLE");
+    return start == id.end() ? 0 : start->second;
+}
+
+// Greedy capacity route from 'start' over the zones whose bit is clear in 'open' (set as
+// they are served): nearest zone next, unloading at the nearest yard whenever the load
+// reaches TRUCK_CAPACITY. loadRow(u, row) writes road distances from u into row[0..n).
+// Read-only, so several tours can be built at once.
+template<class RowFn>
+CapacityTour capacityTour(int start, VisitedMask& open, const vector<int>& fill, RowFn loadRow) const {
+    CapacityTour t;
+    int n = adj.size();
+    if(n == 0) return t;
+
+    vector<int> row(n);
+    int cur = start;
     int load = 0;
-    vector<int> visited(zones.size(),0);
+    loadRow(cur, row.data());
+    t.path.push_back(cur);
+
+    while(true) {
+        if(!open.test(cur)) {
+            load += fill[cur];
+            t.load += fill[cur];
+            open.set(cur);
+            t.served++;
+        }
+
+        if(load >= TRUCK_CAPACITY) {
+            int yard = -1, yardKm = INF;
+            for(int d : depots)       // ties go to the lower zone id
+                if(d < n && (row[d] < yardKm || (row[d] == yardKm && d < yard))) yardKm = row[d], yard = d;
+            if(yard != -1) {
+                t.km += yardKm;
+                t.yardTrips++;
+                t.path.push_back(yard);
+                cur = yard;
+                load = 0;
+                loadRow(cur, row.data());
+            }
+        }
+
+        int best;
+        int nxt = maskedArgmin(row.data(), open.data(), n, best);
+        if(nxt == -1) break;
+        t.km += best;
+        t.path.push_back(nxt);
+        cur = nxt;
+        loadRow(cur, row.data());
+    }
+    return t;
+}
+
+// Road distances from the precomputed matrix
+void matrixRow(int u, int* row) const {
+    DistanceMatrix::RowView view = dist[u];
+    for(int j = 0; j < (int)adj.size(); j++) row[j] = view[j];
+}
+
+void capacityRoute(){
+    int n = adj.size();
+
+    // The truck visits and empties every zone; yards and transfer stations are only unloaded at
+    VisitedMask open(n);
+    vector<int> fill(n);
+    int pending = 0, offNetwork = 0;
+    for(int i=0;i<(int)zones.size();i++){
+        bool collect = !zones[i].isDepot;
+        if(i >= n){
+            offNetwork += collect;      // added later, no roads yet
+            continue;
+        }
+        fill[i] = zones[i].currentWaste;
+        if(collect) pending++;
+        else open.set(i);
+    }
+    VisitedMask collected = open;       // set bits: not collected by this route
+
+    CapacityTour tour = capacityTour(routeStartZone(), open, fill, [this](int u, int* row) { matrixRow(u, row); });
+    if(tour.path.empty()){
+        cout << RED << "No road network loaded.\n" << RESET;
+        return;
+    }
 
     cout << BLUE << "=========== CAPACITY ROUTE (200 UNITS) ===========\n" << RESET;
     cout << left << setw(6) << "STOP" << setw(COLUMN_WIDTH) << "LOCATION" << "LOAD\n";
     cout << "--------------------------------------------------------------\n";
 
     int step = 1;
-    int totalDistance = 0;
-    int dumpVisits = 0;
-    
-    while(true){
-        if(!visited[cur] && cur != dumpingYard){
-            load += zones[cur].currentWaste;
-            zones[cur].currentWaste = 0;
-            visited[cur] = 1;
+    int load = 0;
+    map<int, int> visitsPerDepot;
+    for(int i = 0; i < (int)tour.path.size(); i++){
+        int cur = tour.path[i];
+        if(i > 0 && zones[cur].isDepot){
+            cout << RED << "Truck full -> Going to " << zones[cur].name << " (" << dist[tour.path[i-1]][cur] << " km)\n" << RESET;
+            load = 0;
+            visitsPerDepot[cur]++;
+        } else if(!collected.test(cur)){
+            load += fill[cur];
+            collected.set(cur);
+            setZoneWaste(cur, 0);
         }
 
         cout << "(" << step++ << ")   "
              << left << setw(COLUMN_WIDTH) << zones[cur].name
              << load << "\n";
-
-        if(load >= TRUCK_CAPACITY && cur != dumpingYard){
-            int dumpDist = dist[cur][dumpingYard];
-            totalDistance += dumpDist;
-            cout << RED << "Truck full -> Going to Dumping Yard (" << dumpDist << " km)\n" << RESET;
-            cur = dumpingYard;
-            load = 0;
-            dumpVisits++;
-        }
-
-        int nxt=-1, best=INF;
-        for(int i=0;i<zones.size();i++)
-            if(!visited[i] && i != dumpingYard && dist[cur][i]<best)
-                best = dist[cur][i], nxt=i;
-
-        if(nxt==-1) break;
-        totalDistance += best;
-        cur = nxt;
     }
 
     cout << "--------------------------------------------------------------\n";
-    cout << GREEN << "Route Completed. Final location: " << zones[cur].name << RESET << "\n";
-    cout << "Total Distance: " << totalDistance << " km\n";
-    cout << "Dumping Yard Visits: " << dumpVisits << "\n";
-    double cost = (totalDistance / TRUCK_MILEAGE) * FUEL_PRICE;
+    cout << GREEN << "Route Completed. Final location: " << zones[tour.path.back()].name << RESET << "\n";
+    cout << "Zones Collected: " << tour.served << "\n";
+    if(pending - tour.served + offNetwork > 0)
+        cout << YELLOW << pending - tour.served + offNetwork << " zone(s) could not be reached by road.\n" << RESET;
+    cout << "Total Distance: " << tour.km << " km\n";
+    cout << "Dumping Yard Visits: " << tour.yardTrips << "\n";
+    for(auto& v : visitsPerDepot) {
+        cout << "  - " << zones[v.first].name << ": " << v.second << "\n";
+    }
+    double cost = (tour.km / TRUCK_MILEAGE) * FUEL_PRICE;
     cout << "Total Cost: Rs. " << fixed << setprecision(2) << cost << "\n";
 }
 
@@ -1280,62 +6199,103 @@ ROUTE COMPARISON FUNCTIONALITY
 void compareRoutes(){
     system("cls");
     
-    if(savedRoutes.empty()) {
+    if(routeStore.empty()) {
         cout << YELLOW << "No saved routes to compare. Generate routes first using TSP-Lite.\n" << RESET;
         return;
     }
     
     cout << BLUE << "=============== ROUTE COMPARISON ===============\n" << RESET;
-    cout << "Number of saved routes: " << savedRoutes.size() << "\n\n";
+    cout << "Number of saved routes: " << routeStore.size() << "\n\n";
     
-    if(savedRoutes.size() < 2) {
+    if(routeStore.size() < 2) {
         cout << YELLOW << "Need at least 2 routes for comparison.\n" << RESET;
         return;
     }
+
+    cout << "1. Most Recent Routes\n";
+    cout << "2. Routes in a Date Range\n";
+    cout << "3. Routes by Driver\n";
+    cout << "4. Routes from a Starting Zone\n";
+    cout << "Enter choice: ";
+    int filter;
+    cin >> filter;
+
+    vector<int> selected;
+    if(filter == 2) {
+        int from, to;
+        cout << CYAN << "From date (yyyymmdd): " << RESET;
+        cin >> from;
+        cout << CYAN << "To date (yyyymmdd): " << RESET;
+        cin >> to;
+        selected = routeStore.between(from, to);
+    } else if(filter == 3) {
+        string driver;
+        cout << CYAN << "Driver username: " << RESET;
+        cin >> driver;
+        selected = routeStore.forDriver(driver);
+    } else if(filter == 4) {
+        string zoneName;
+        cout << CYAN << "Starting zone name: " << RESET;
+        cin >> zoneName;
+        for(char &c : zoneName) c = toupper(c);
+        if(!id.count(zoneName)) {
+            cout << RED << "Zone not found.\n" << RESET;
+            return;
+        }
+        selected = routeStore.fromZone(id[zoneName]);
+    } else {
+        for(int i = max(0, routeStore.size() - 20); i < routeStore.size(); i++) selected.push_back(i);
+    }
+
+    if(selected.empty()) {
+        cout << YELLOW << "No routes match this filter.\n" << RESET;
+        return;
+    }
     
-    cout << left << setw(10) << "ROUTE #"
+    cout << "\n" << left << setw(10) << "ROUTE #"
+         << setw(12) << "DATE"
+         << setw(15) << "DRIVER"
          << setw(15) << "DISTANCE (km)"
          << setw(15) << "COST (Rs.)"
          << setw(15) << "WASTE"
          << "STOPS\n";
     cout << "--------------------------------------------------------------\n";
     
-    for(int i = 0; i < savedRoutes.size(); i++) {
-        Route& r = savedRoutes[i];
-        cout << left << setw(10) << (i+1)
-             << setw(15) << r.totalDistance
-             << setw(15) << fixed << setprecision(2) << r.totalCost
-             << setw(15) << r.totalWaste
-             << r.path.size() << "\n";
+    for(int rid : selected) {
+        const RouteStore::Summary& r = routeStore.summary(rid);
+        cout << left << setw(10) << (rid+1)
+             << setw(12) << r.date
+             << setw(15) << routeStore.driverName(rid)
+             << setw(15) << r.distance
+             << setw(15) << fixed << setprecision(2) << r.cost
+             << setw(15) << r.waste
+             << r.stops << "\n";
     }
     
     cout << "--------------------------------------------------------------\n";
     
-    // Find best route by different criteria
-    int bestDistance = 0, bestCost = 0, bestWaste = 0;
-    int minDist = savedRoutes[0].totalDistance;
-    double minCost = savedRoutes[0].totalCost;
-    int maxWaste = savedRoutes[0].totalWaste;
-    
-    for(int i = 0; i < savedRoutes.size(); i++) {
-        if(savedRoutes[i].totalDistance < minDist) {
-            minDist = savedRoutes[i].totalDistance;
-            bestDistance = i;
-        }
-        if(savedRoutes[i].totalCost < minCost) {
-            minCost = savedRoutes[i].totalCost;
-            bestCost = i;
-        }
-        if(savedRoutes[i].totalWaste > maxWaste) {
-            maxWaste = savedRoutes[i].totalWaste;
-            bestWaste = i;
-        }
+    // Best of the selection: one pass over in-memory summaries, no disk reads
+    int bestDistance = selected[0], bestCost = selected[0], bestWaste = selected[0];
+    for(int rid : selected) {
+        const RouteStore::Summary& r = routeStore.summary(rid);
+        if(r.distance < routeStore.summary(bestDistance).distance) bestDistance = rid;
+        if(r.cost < routeStore.summary(bestCost).cost) bestCost = rid;
+        if(r.waste > routeStore.summary(bestWaste).waste) bestWaste = rid;
     }
     
     cout << GREEN << "\nBEST ROUTES:\n" << RESET;
-    cout << "Shortest Distance: Route #" << (bestDistance + 1) << " (" << minDist << " km)\n";
-    cout << "Lowest Cost: Route #" << (bestCost + 1) << " (Rs. " << fixed << setprecision(2) << minCost << ")\n";
-    cout << "Maximum Waste: Route #" << (bestWaste + 1) << " (" << maxWaste << " units)\n";
+    cout << "Shortest Distance: Route #" << (bestDistance + 1) << " (" << routeStore.summary(bestDistance).distance << " km)\n";
+    cout << "Lowest Cost: Route #" << (bestCost + 1) << " (Rs. " << fixed << setprecision(2) << routeStore.summary(bestCost).cost << ")\n";
+    cout << "Maximum Waste: Route #" << (bestWaste + 1) << " (" << routeStore.summary(bestWaste).waste << " units)\n";
+
+    // All-time leaders come straight from the top-k indexes
+    const char* titles[3] = {"Shortest Distance", "Lowest Cost", "Maximum Waste"};
+    cout << CYAN << "\nALL-TIME TOP " << RouteStore::TOP_K << " (" << routeStore.size() << " routes on record):\n" << RESET;
+    for(int m = 0; m < 3; m++) {
+        cout << left << setw(20) << titles[m];
+        for(int rid : routeStore.best((RouteStore::Metric)m)) cout << "#" << (rid + 1) << " ";
+        cout << "\n";
+    }
 }
 
 /**********************************************************************************************
@@ -1346,25 +6306,30 @@ void statisticalAnalysis(){
     
     cout << BLUE << "=============== STATISTICAL ANALYSIS ===============\n" << RESET;
     
-    int totalZones = zones.size();
-    int totalWaste = 0;
+    // Works on one published version, so the figures are consistent with each other
+    auto snap = pinZoneState();
+    // Counts come from the version's fill-level histogram: 101 buckets, not one per zone
+    int totalZones = snap->size();
+    long long totalWaste = snap->totalWaste;
     int criticalZones = 0;
     int warningZones = 0;
     int healthyZones = 0;
     int maxWaste = 0, minWaste = 100;
     
-    for(auto& zone : zones) {
-        totalWaste += zone.currentWaste;
-        if(zone.currentWaste > maxWaste) maxWaste = zone.currentWaste;
-        if(zone.currentWaste < minWaste) minWaste = zone.currentWaste;
+    for(int level = 0; level < (int)snap->levelCount.size(); level++) {
+        int n = snap->levelCount[level];
+        if(n == 0) continue;
+        maxWaste = max(maxWaste, level);
+        minWaste = min(minWaste, level);
         
-        if(zone.currentWaste > 80) criticalZones++;
-        else if(zone.currentWaste > 50) warningZones++;
-        else healthyZones++;
+        if(level > 80) criticalZones += n;
+        else if(level > 50) warningZones += n;
+        else healthyZones += n;
     }
     
     double avgWaste = (double)totalWaste / totalZones;
     
+    cout << left << setw(30) << "Data Version:" << snap->version << "\n";
     cout << left << setw(30) << "Total Zones:" << totalZones << "\n";
     cout << left << setw(30) << "Average Waste Level:" << fixed << setprecision(2) << avgWaste << "%\n";
     cout << left << setw(30) << "Maximum Waste Level:" << maxWaste << "%\n";
@@ -1412,18 +6377,24 @@ void shortestPath(){
         cout << YELLOW << "Multiple destination matches. Using first: " << zones[dst].name << "\n" << RESET;
     }
     
-    // Use Floyd-Warshall distance matrix (already computed)
-    if(dist[src][dst] == INF) {
+    // Contraction hierarchy query (distance and road-level path)
+    int d = ch.query(src, dst);
+    if(d == INF) {
         cout << RED << "No path exists between " << zones[src].name << " and " << zones[dst].name << "\n" << RESET;
         return;
     }
+    vector<int> roads = ch.path(src, dst);
     
     cout << GREEN << "\n========== SHORTEST PATH RESULT ==========\n" << RESET;
     cout << "From: " << zones[src].name << "\n";
     cout << "To: " << zones[dst].name << "\n";
-    cout << "Shortest Distance: " << dist[src][dst] << " km\n";
-    cout << "Estimated Time: " << (dist[src][dst] * 2) << " minutes (assuming 30 km/h)\n";
-    double cost = (dist[src][dst] / TRUCK_MILEAGE) * FUEL_PRICE;
+    cout << "Shortest Distance: " << d << " km\n";
+    cout << "Estimated Time: " << (d * 2) << " minutes (assuming 30 km/h)\n";
+    cout << "Road Path: ";
+    for(int i = 0; i < (int)roads.size(); i++) {
+        cout << zones[roads[i]].name << (i + 1 < (int)roads.size() ? " -> " : "\n");
+    }
+    double cost = (d / TRUCK_MILEAGE) * FUEL_PRICE;
     cout << "Fuel Cost: Rs. " << fixed << setprecision(2) << cost << "\n";
     cout << "==========================================\n" << RESET;
 }
@@ -1471,6 +6442,7 @@ void zoneManagement(){
         cout << "3. Add New Zone\n";
         cout << "4. Display Zone Details\n";
         cout << "5. List All Zones\n";
+        cout << "6. Mark Zone as Dumping Yard / Transfer Station\n";
         cout << "0. Return to Main Menu\n";
         cout << "==============================================\n";
         cout << "Enter choice: ";
@@ -1574,10 +6546,10 @@ void zoneManagement(){
                 continue;
             }
 
-            zones[zid].currentWaste = newWaste;
-            zones[zid].history.push_back(newWaste);
-            if(zones[zid].history.size() > MAX_HISTORY_SIZE)
-                zones[zid].history.erase(zones[zid].history.begin());
+            int day = WasteForecaster::today();
+            recordDailyLevel(zones[zid], newWaste, day);
+            forecaster.observe(zid, newWaste, day);
+            setZoneWaste(zid, newWaste);
 
             if(newWaste > 80) zones[zid].priority = 1;
             else if(newWaste > 50) zones[zid].priority = 2;
@@ -1601,6 +6573,8 @@ void zoneManagement(){
             zones.push_back(newZone);
             id[name] = newId;
             lookupTable.insert(newId, name);
+            forecaster.addZone(newZone);
+            rebuildFillIndexes();
 
             cout << GREEN << "Zone Added! ID: " << newId << RESET << "\n";
             cout << YELLOW << "Add road connections manually later.\n" << RESET;
@@ -1656,6 +6630,34 @@ void zoneManagement(){
         else if(choice == 5){
             showZones();
         }
+        else if(choice == 6){
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            cout << CYAN << "Enter zone name (partial/full): " << RESET;
+            string input;
+            getline(cin, input);
+
+            for(char &c : input) c = toupper(c);
+
+            vector<int> matches = lookupTable.findAllMatches(input);
+
+            if(matches.empty() || matches[0] >= (int)adj.size()){
+                cout << RED << "\nZone not found or not connected to the road network.\n" << RESET;
+                continue;
+            }
+
+            int zid = matches[0];
+            if(zones[zid].isDepot){
+                cout << YELLOW << zones[zid].name << " is already a depot.\n" << RESET;
+                continue;
+            }
+
+            zones[zid].isDepot = true;
+            depots.push_back(zid);
+            nearestDepot.addFacility(adj, zid);
+            rebuildFillIndexes();   // yard distances shrank around the new depot
+
+            cout << GREEN << zones[zid].name << " now accepts waste. Depots: " << depots.size() << "\n" << RESET;
+        }
 
         if(choice != 0){
             cout << "\nPress ENTER to continue...";
@@ -1669,7 +6671,17 @@ void zoneManagement(){
 /**********************************************************************************************
 WASTE TREND ANALYSIS USING SEGMENT TREE
 **********************************************************************************************/
+static string etaText(int minutes) {
+    if(minutes == OverflowEtaIndex::NEVER) return "-";
+    if(minutes == 0) return "FULL";
+    if(minutes < 60) return to_string(minutes) + " min";
+    if(minutes < 48 * 60) return to_string(minutes / 60) + " h";
+    return to_string(minutes / (24 * 60)) + " days";
+}
+
 void wasteTrendAnalysis(){
+    static constexpr int ALERT_HOURS = 24;
+
     system("cls");
     cout << BLUE << "=============== WASTE TREND ANALYSIS ===============\n" << RESET;
 
@@ -1681,78 +6693,102 @@ void wasteTrendAnalysis(){
     cout << left << setw(COLUMN_WIDTH) << "ZONE NAME"
          << setw(15) << "CURRENT"
          << setw(15) << "MAX (HIST)"
-         << setw(15) << "TREND\n";
-    cout << "--------------------------------------------------------------\n";
+         << setw(15) << "TREND/DAY"
+         << "FULL IN\n";
+    cout << "------------------------------------------------------------------------------------\n";
 
+    int now = OverflowEtaIndex::now();
     for(int i=0; i<zones.size(); i++) {
         Zone& z = zones[i];
-        if(segmentTrees[i] != nullptr && z.history.size() > 1) {
+        string full = etaText(overflowEta.minutesLeft(i, now));
+        if(i < (int)segmentTrees.size() && segmentTrees[i] != nullptr && forecaster.hasTrend(i)) {
             int maxHist = segmentTrees[i]->getMax();
-            int trend = 0;
-            if(z.history.size() >= 2) {
-                trend = z.currentWaste - z.history[z.history.size()-2];
-            }
+            int trend = (int)lround(forecaster.trendOf(i));
 
             string trendStr = (trend > 0) ? "+" + to_string(trend) : to_string(trend);
             string trendCol = (trend > 5) ? RED : (trend > 0) ? YELLOW : GREEN;
 
             cout << left << setw(COLUMN_WIDTH) << z.name
-                 << setw(15) << z.currentWaste << "%"
-                 << setw(15) << maxHist << "%"
-                 << trendCol << trendStr << "%" << RESET << "\n";
+                 << setw(15) << to_string(z.currentWaste) + "%"
+                 << setw(15) << to_string(maxHist) + "%"
+                 << trendCol << setw(15) << trendStr + "%" << RESET
+                 << full << "\n";
         } else {
             cout << left << setw(COLUMN_WIDTH) << z.name
-                 << setw(15) << z.currentWaste << "%"
+                 << setw(15) << to_string(z.currentWaste) + "%"
                  << setw(15) << "N/A"
-                 << setw(15) << "N/A\n";
+                 << setw(15) << "N/A"
+                 << full << "\n";
         }
     }
 
-    cout << "--------------------------------------------------------------\n";
+    cout << "------------------------------------------------------------------------------------\n";
+
+    vector<int> due;
+    overflowEta.dueBy(now + ALERT_HOURS * 60, due);
+    if(due.empty()) {
+        cout << GREEN << "No zone is projected to fill up in the next " << ALERT_HOURS << " hours.\n" << RESET;
+        return;
+    }
+    cout << RED << "\nOVERFLOW ALERTS — full within " << ALERT_HOURS << " hours (soonest first)\n" << RESET;
+    for(int zid : due)
+        cout << RED << " ! " << RESET << left << setw(COLUMN_WIDTH) << zones[zid].name
+             << setw(8) << to_string(zones[zid].currentWaste) + "%"
+             << etaText(overflowEta.minutesLeft(zid, now)) << "\n";
 }
 
 /**********************************************************************************************
 ADVANCED ROUTE OPTIMIZATION
 **********************************************************************************************/
+// Totals for a stop sequence; every optimiser reports through the same evaluator
+Route evaluateRoute(const vector<int>& path) {
+    RouteEvaluator eval(zones, dist);
+    eval.assign(path);
+    return eval.toRoute();
+}
+
 Route optimizedRouteGreedy(int start, vector<int>& targets) {
     Route route;
     if(targets.empty()) return route;
 
-    vector<bool> visited(zones.size(), false);
     route.path.push_back(start);
-    visited[start] = true;
-    int current = start;
-    int totalDist = 0;
-
-    targets.erase(remove(targets.begin(), targets.end(), start), targets.end());
-
-    while(!targets.empty()) {
-        int nearest = -1;
-        int minDist = INF;
-
-        for(int target : targets) {
-            if(!visited[target] && dist[current][target] < minDist) {
-                minDist = dist[current][target];
-                nearest = target;
-            }
-        }
 
-        if(nearest == -1) break;
-
-        totalDist += minDist;
-        route.path.push_back(nearest);
-        visited[nearest] = true;
-        current = nearest;
-        targets.erase(remove(targets.begin(), targets.end(), nearest), targets.end());
+    // Distance table over the stop set only: row/column 0 is the start, k is stops[k]
+    ArenaScope scope;
+    pmr::memory_resource* mem = scratchResource();
+    pmr::vector<int> stops(1, start, mem);
+    pmr::vector<bool> seen(zones.size(), false, mem);
+    stops.reserve(targets.size() + 1);
+    seen[start] = true;
+    for(int t : targets) {
+        if(!seen[t]) stops.push_back(t);
+        seen[t] = true;
     }
-
-    route.totalDistance = totalDist;
-    route.totalCost = (totalDist / TRUCK_MILEAGE) * FUEL_PRICE;
-    for(int zid : route.path) {
-        route.totalWaste += zones[zid].currentWaste;
+    int m = stops.size();
+    pmr::vector<int> table((size_t)m * m, mem);
+    ch.manyToMany(stops.data(), m, stops.data(), m, table.data());
+
+    VisitedMask visited(m, mem);
+    visited.set(0);
+    int currentIdx = 0;
+    route.path.reserve(m);
+
+    for(int step = 1; step < m; step++) {
+        int minDist;
+        int nearestIdx = maskedArgmin(&table[(size_t)currentIdx * m], visited.data(), m, minDist);
+        if(nearestIdx == -1) break;
+
+        route.path.push_back(stops[nearestIdx]);
+        visited.set(nearestIdx);
+        currentIdx = nearestIdx;
     }
 
-    return route;
+    // Whatever is left in 'targets' is what this route could not reach
+    targets.clear();
+    for(int k = 1; k < m; k++)
+        if(!visited.test(k)) targets.push_back(stops[k]);
+
+    return evaluateRoute(route.path);
 }
 
 Route optimizedRoutePriority(int start, vector<int>& targets) {
@@ -1764,24 +6800,69 @@ Route optimizedRoutePriority(int start, vector<int>& targets) {
     });
 
     route.path.push_back(start);
-    int current = start;
-    int totalDist = 0;
-
     for(int target : targets) {
-        if(target != start) {
-            totalDist += dist[current][target];
-            route.path.push_back(target);
-            current = target;
-        }
+        if(target != start) route.path.push_back(target);
     }
 
-    route.totalDistance = totalDist;
-    route.totalCost = (totalDist / TRUCK_MILEAGE) * FUEL_PRICE;
-    for(int zid : route.path) {
-        route.totalWaste += zones[zid].currentWaste;
-    }
+    return evaluateRoute(route.path);
+}
+
+Route optimizedRouteExact(int start, vector<int>& targets, bool& provedOptimal) {
+    Route route;
+    provedOptimal = false;
+    if(targets.empty()) return route;
+
+    targets.erase(remove(targets.begin(), targets.end(), start), targets.end());
+
+    vector<int> stops = targets;
+    stops.insert(stops.begin(), start);
+    vector<vector<int>> table = ch.manyToMany(stops, stops);
+
+    ExactTspSolver::Result res = ExactTspSolver::solve(table, plannerPool(), 5.0);
+    if(res.cost == INF) return route;
+
+    for(int idx : res.order) route.path.push_back(stops[idx]);
+    provedOptimal = res.optimal;
+
+    return evaluateRoute(route.path);
+}
+
+Route optimizedRouteImproved(int start, vector<int>& targets, double seconds, int& lowerBound) {
+    Route greedy = optimizedRouteGreedy(start, targets);
+    Route route;
+    lowerBound = 0;
+    if(greedy.path.empty()) return route;
+
+    TourImprover improver(dist, greedy.path);
+    vector<int> order(greedy.path.size());
+    iota(order.begin(), order.end(), 0);
+    // One budget for both: the bound gets up to a third, the search whatever is left
+    auto deadline = chrono::steady_clock::now() + chrono::duration<double>(seconds);
+    lowerBound = improver.lowerBound(seconds / 3);
+    double left = chrono::duration<double>(deadline - chrono::steady_clock::now()).count();
+    TourImprover::Result res = improver.improve(order, max(left, 0.0), INT_MAX);
+
+    for(int idx : res.tour) route.path.push_back(greedy.path[idx]);
+
+    return evaluateRoute(route.path);
+}
 
-    return route;
+Route optimizedRouteParallel(int start, vector<int>& targets, int threads, double seconds, int& restarts) {
+    Route route;
+    restarts = 0;
+    targets.erase(remove(targets.begin(), targets.end(), start), targets.end());
+
+    vector<int> stops = targets;
+    stops.insert(stops.begin(), start);
+
+    ParallelRouteSearch search(dist, stops);
+    ParallelRouteSearch::Result res = search.run(threads, seconds);
+    if(res.cost == INF) return route;
+
+    for(int idx : res.tour) route.path.push_back(stops[idx]);
+    restarts = res.restarts;
+
+    return evaluateRoute(route.path);
 }
 
 void advancedRouteOptimization(){
@@ -1825,16 +6906,19 @@ void advancedRouteOptimization(){
     cout << "1. Greedy Nearest Neighbor\n";
     cout << "2. Priority-based (Highest Waste First)\n";
     cout << "3. Compare Both Strategies\n";
+    cout << "4. Exact Optimum (Held-Karp <= " << ExactTspSolver::HELD_KARP_LIMIT << " stops, else Branch & Bound)\n";
+    cout << "5. Local Search (2-opt / Or-opt, time bounded)\n";
+    cout << "6. Parallel Multi-Start Search (all cores, time bounded)\n";
     cout << "Enter choice: ";
     int strategy;
     cin >> strategy;
 
     vector<int> targets;
-    for(int i=0; i<zones.size(); i++){
-        if(i != start && zones[i].currentWaste > 50 && i != dumpingYard){
-            targets.push_back(i);
-        }
-    }
+    fillIndex.atLeast(51, targets);
+    targets.erase(remove_if(targets.begin(), targets.end(), [&](int i) {
+        return i == start || zones[i].isDepot;
+    }), targets.end());
+    sort(targets.begin(), targets.end());
 
     if(targets.empty()){
         cout << YELLOW << "No high-priority zones to optimize.\n" << RESET;
@@ -1855,6 +6939,7 @@ void advancedRouteOptimization(){
         cout << "Route Order: ";
         for(int id : R.path) cout << zones[id].name << " -> ";
         cout << "END\n";
+        printRoadPath(R);
     }
 
     if(strategy == 2 || strategy == 3){
@@ -1868,6 +6953,91 @@ void advancedRouteOptimization(){
         cout << "Route Order: ";
         for(int id : R.path) cout << zones[id].name << " -> ";
         cout << "END\n";
+        printRoadPath(R);
+    }
+
+    if(strategy == 4){
+        vector<int> temp = targets;
+        bool provedOptimal;
+        Route R = optimizedRouteExact(start, temp, provedOptimal);
+
+        cout << CYAN << "\n--- EXACT ROUTE (" << (targets.size() <= ExactTspSolver::HELD_KARP_LIMIT ? "Held-Karp" : "Branch & Bound")
+             << ") ---\n" << RESET;
+        if(R.path.empty()) {
+            cout << RED << "No route visits every target (disconnected road network).\n" << RESET;
+        } else {
+            cout << "Distance: " << R.totalDistance << " km"
+                 << (provedOptimal ? " (proven optimal)" : " (best found within time limit)") << "\n";
+            cout << "Cost: Rs. " << fixed << setprecision(2) << R.totalCost << "\n";
+            cout << "Stops: " << R.path.size() << "\n";
+            cout << "Route Order: ";
+            for(int id : R.path) cout << zones[id].name << " -> ";
+            cout << "END\n";
+            printRoadPath(R);
+
+            vector<int> t1 = targets;
+            Route G = optimizedRouteGreedy(start, t1);
+            cout << GREEN << "Saves " << (G.totalDistance - R.totalDistance) << " km over the greedy route\n" << RESET;
+        }
+    }
+
+    if(strategy == 5){
+        cout << CYAN << "Enter time budget in seconds: " << RESET;
+        double seconds;
+        cin >> seconds;
+        if(seconds <= 0 || seconds > 600) seconds = 2.0;
+
+        vector<int> temp = targets;
+        int lowerBound;
+        Route R = optimizedRouteImproved(start, temp, seconds, lowerBound);
+
+        cout << CYAN << "\n--- LOCAL SEARCH ROUTE (" << seconds << "s budget) ---\n" << RESET;
+        cout << "Distance: " << R.totalDistance << " km\n";
+        cout << "Lower Bound (1-tree): " << lowerBound << " km\n";
+        cout << "Optimality Gap: " << fixed << setprecision(2)
+             << (lowerBound > 0 ? 100.0 * (R.totalDistance - lowerBound) / lowerBound : 0.0) << "%\n";
+        cout << "Cost: Rs. " << fixed << setprecision(2) << R.totalCost << "\n";
+        cout << "Stops: " << R.path.size() << "\n";
+        cout << "Route Order: ";
+        for(int id : R.path) cout << zones[id].name << " -> ";
+        cout << "END\n";
+        printRoadPath(R);
+    }
+
+    if(strategy == 6){
+        cout << CYAN << "Enter time budget in seconds (per run): " << RESET;
+        double seconds;
+        cin >> seconds;
+        if(seconds <= 0 || seconds > 600) seconds = 2.0;
+
+        int cores = max(1u, thread::hardware_concurrency());
+        vector<int> temp = targets;
+        int restarts;
+        Route R = optimizedRouteParallel(start, temp, cores, seconds, restarts);
+
+        cout << CYAN << "\n--- PARALLEL MULTI-START ROUTE (" << cores << " threads) ---\n" << RESET;
+        cout << "Distance: " << R.totalDistance << " km\n";
+        cout << "Cost: Rs. " << fixed << setprecision(2) << R.totalCost << "\n";
+        cout << "Restarts: " << restarts << "\n";
+        cout << "Stops: " << R.path.size() << "\n";
+        cout << "Route Order: ";
+        for(int id : R.path) cout << zones[id].name << " -> ";
+        cout << "END\n";
+        printRoadPath(R);
+
+        // Solution quality vs. number of threads at the same wall-clock budget
+        cout << CYAN << "\nSCALING REPORT (same " << seconds << "s budget):\n" << RESET;
+        cout << left << setw(10) << "THREADS" << setw(15) << "BEST (km)" << "RESTARTS\n";
+        vector<int> threadCounts;
+        for(int t = 1; t < cores; t *= 2) threadCounts.push_back(t);
+        threadCounts.push_back(cores);
+
+        for(int t : threadCounts) {
+            vector<int> again = targets;
+            int runs;
+            Route S = optimizedRouteParallel(start, again, t, seconds, runs);
+            cout << left << setw(10) << t << setw(15) << S.totalDistance << runs << "\n";
+        }
     }
 
     if(strategy == 3){
@@ -1899,25 +7069,16 @@ void costAnalysis(){
     cout << BLUE << "=============== COST ANALYSIS REPORT ===============\n" << RESET;
 
     int totalZones = zones.size();
-    int totalWaste = 0;
-    int criticalCount = 0;
-
-    for(auto& zone : zones) {
-        totalWaste += zone.currentWaste;
-        if(zone.currentWaste > 80) criticalCount++;
-    }
+    long long totalWaste = fillIndex.totalWaste();
+    int criticalCount = fillIndex.critical();
 
     double avgWaste = (double)totalWaste / totalZones;
 
-    int collectionsNeeded = 0;
-    int totalDistanceEstimate = 0;
-
-    for(auto& zone : zones) {
-        if(zone.currentWaste > 50) {
-            collectionsNeeded++;
-            totalDistanceEstimate += 5;
-        }
-    }
+    vector<int> needCollection;
+    fillIndex.atLeast(51, needCollection);
+    sort(needCollection.begin(), needCollection.end());
+    int collectionsNeeded = needCollection.size();
+    int totalDistanceEstimate = 5 * collectionsNeeded;
 
     double estimatedFuel = (double)totalDistanceEstimate / TRUCK_MILEAGE;
     double estimatedCost = estimatedFuel * FUEL_PRICE;
@@ -1937,13 +7098,12 @@ void costAnalysis(){
          << setw(15) << "EST. COST\n";
     cout << "--------------------------------------------------------------\n";
 
-    for(auto& zone : zones) {
-        if(zone.currentWaste > 50) {
-            double zoneCost = (5.0 / TRUCK_MILEAGE) * FUEL_PRICE;
-            cout << left << setw(COLUMN_WIDTH) << zone.name
-                 << setw(15) << zone.currentWaste << "%"
-                 << "Rs. " << fixed << setprecision(2) << zoneCost << "\n";
-        }
+    for(int zid : needCollection) {
+        const Zone& zone = zones[zid];
+        double zoneCost = (5.0 / TRUCK_MILEAGE) * FUEL_PRICE;
+        cout << left << setw(COLUMN_WIDTH) << zone.name
+             << setw(15) << zone.currentWaste << "%"
+             << "Rs. " << fixed << setprecision(2) << zoneCost << "\n";
     }
 
     cout << "--------------------------------------------------------------\n";
@@ -2050,79 +7210,535 @@ void batchZoneUpdate(){
     system("cls");
     cout << BLUE << "=============== BATCH ZONE UPDATE ===============\n" << RESET;
 
-    cin.ignore(numeric_limits<streamsize>::max(), '\n');
-    cout << CYAN << "Enter number of zones to update: " << RESET;
-    int count;
-    cin >> count;
+    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    cout << CYAN << "Enter number of zones to update: " << RESET;
+    int count;
+    cin >> count;
+
+    if(count <= 0 || count > zones.size()) {
+        cout << RED << "Invalid count.\n" << RESET;
+        return;
+    }
+
+    int updated = 0;
+
+    for(int i = 0; i < count; i++) {
+
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        cout << "\nZone " << (i + 1) << ":\n";
+        cout << CYAN << "Enter zone name (partial or full): " << RESET;
+        string input;
+        getline(cin, input);
+
+        for(char &c : input) c = toupper(c);
+
+        vector<int> matches;
+        for(int z = 0; z < zones.size(); z++){
+            string temp = zones[z].name;
+            for(char &c : temp) c = toupper(c);
+            if(temp.find(input) != string::npos){
+                matches.push_back(z);
+            }
+        }
+
+        if(matches.empty()){
+            cout << YELLOW << "No matching zone found. Skipping.\n" << RESET;
+            continue;
+        }
+
+        int zid;
+        if(matches.size() > 1){
+            cout << YELLOW << "Multiple matches found, choose one:" << RESET << "\n";
+            for(int j = 0; j < matches.size(); j++)
+                cout << (j + 1) << ". " << zones[matches[j]].name << "\n";
+
+            int ch;
+            cout << CYAN << "Enter choice: " << RESET;
+            cin >> ch;
+
+            if(ch < 1 || ch > matches.size()){
+                cout << RED << "Invalid choice. Skipping.\n" << RESET;
+                continue;
+            }
+            zid = matches[ch - 1];
+        }
+        else {
+            zid = matches[0];
+        }
+
+        cout << "Current waste: " << zones[zid].currentWaste << "%\n";
+        cout << CYAN << "Enter new waste level (0-100): " << RESET;
+        int newWaste;
+        cin >> newWaste;
+
+        if(newWaste >= 0 && newWaste <= 100){
+            int day = WasteForecaster::today();
+            recordDailyLevel(zones[zid], newWaste, day);
+            forecaster.observe(zid, newWaste, day);
+            setZoneWaste(zid, newWaste);
+            updated++;
+            cout << GREEN << "Updated successfully.\n" << RESET;
+        }
+        else{
+            cout << RED << "Invalid waste level. Skipped.\n" << RESET;
+        }
+    }
+
+    cout << GREEN << "\nBatch update complete. " << updated << " zones updated.\n" << RESET;
+}
+
+/**********************************************************************************************
+LIVE SENSOR FEED — BULK APPLY AT SAFE POINTS
+**********************************************************************************************/
+// One batch: levels and history first, then each touched zone's history index is rebuilt once
+void applySensorBatch(const vector<SensorFeed::Reading>& batch) {
+    vector<char> touched(zones.size(), 0);
+    int touchedCount = 0;
+    int day = WasteForecaster::today();
+    for(const SensorFeed::Reading& r : batch) {
+        Zone& z = zones[r.zone];
+        if(z.isDepot) continue;
+        z.currentWaste = r.level;
+        recordDailyLevel(z, r.level, day);
+        forecaster.observe(r.zone, r.level, day);
+        touchedCount += !touched[r.zone];
+        touched[r.zone] = 1;
+    }
+
+    // Few zones moved: slide them into place; many: one O(N) radix rebuild is cheaper
+    bool rebuildOrder = touchedCount * 16 > (int)zones.size();
+    if(rebuildOrder) rebuildFillIndexes();
+
+    for(int i = 0; i < (int)zones.size(); i++) {
+        if(!touched[i]) continue;
+        Zone& z = zones[i];
+        z.priority = z.currentWaste > 80 ? 1 : (z.currentWaste > 50 ? 2 : 3);
+        if(!rebuildOrder) setZoneWaste(i, z.currentWaste);
+
+        delete segmentTrees[i];
+        segmentTrees[i] = new SegmentTree(z.history);
+    }
+    sensorApplied += batch.size();
+    sensorBatches++;
+}
+
+// Called from the menu loops between actions; returns the number of readings applied
+long long pollSensorFeed() {
+    long long applied = 0;
+    for(auto& batch : sensorFeed.take()) {
+        applySensorBatch(batch);
+        publishZoneState();
+        applied += batch.size();
+    }
+    return applied;
+}
+
+/**********************************************************************************************
+ZONE STATE PUBLICATION (SINGLE WRITER: THIS THREAD, AT SAFE POINTS)
+**********************************************************************************************/
+// Builds an immutable copy of the live levels; a no-op when nothing changed since last time
+void publishZoneState() {
+    ZoneState* next = new ZoneState();
+    next->totalWaste = 0;
+    for(int i = 0; i < (int)zones.size(); i++) {
+        next->waste.push_back(zones[i].currentWaste);
+        next->priority.push_back(zones[i].priority);
+        next->historyMax.push_back(i < (int)segmentTrees.size() && segmentTrees[i] ? segmentTrees[i]->getMax() : 0);
+        next->depot.push_back(zones[i].isDepot);
+        next->totalWaste += zones[i].currentWaste;
+    }
+    next->levelCount.assign(fillIndex.histogram(), fillIndex.histogram() + FillLevelIndex::LEVELS);
+
+    const ZoneState* prev = zoneState.latest();
+    if(prev && prev->waste == next->waste && prev->priority == next->priority &&
+       prev->historyMax == next->historyMax && prev->depot == next->depot) {
+        delete next;
+        return;
+    }
+    next->version = prev ? prev->version + 1 : 1;
+
+    // Counting sort into per-level buckets, so searches can answer from this version alone
+    int n = next->size();
+    next->levelStart.assign(FillLevelIndex::LEVELS + 1, 0);
+    auto bucket = [](int w) { return min(FillLevelIndex::LEVELS - 1, max(0, w)); };
+    for(int w : next->waste) next->levelStart[bucket(w) + 1]++;
+    partial_sum(next->levelStart.begin(), next->levelStart.end(), next->levelStart.begin());
+    vector<int> fillAt(next->levelStart.begin(), next->levelStart.end() - 1);
+    next->byLevel.resize(n);
+    for(int i = 0; i < n; i++) next->byLevel[fillAt[bucket(next->waste[i])]++] = i;
+
+    zoneState.publish(next);
+}
+
+// Lock-free read access for any thread; hold the guard only as long as the data is needed.
+// Writers (route builders, zone edits) stay on the main thread and use 'zones' directly.
+EpochSnapshot<ZoneState>::Guard pinZoneState() {
+    return zoneState.pin();
+}
+
+void sensorFeedMenu() {
+    system("cls");
+    cout << BLUE << "=============== LIVE SENSOR FEED ===============\n" << RESET;
+    string readError = sensorFeed.readError();
+    if(!readError.empty())
+        cout << "Status: " << RED << "READ ERROR (" << sensorFeed.source() << ": " << readError << ")" << RESET << "\n";
+    else
+        cout << "Status: " << (sensorFeed.active() ? string(GREEN) + "RUNNING (" + sensorFeed.source() + ")" : string(YELLOW) + "STOPPED")
+             << RESET << "\n";
+    cout << "Readings applied: " << sensorApplied << " in " << sensorBatches << " batches"
+         << " | rejected lines: " << sensorFeed.readingsRejected() << "\n\n";
+
+    cout << "1. Start Feed (tail a readings file / named pipe)\n";
+    cout << "2. Stop Feed\n";
+    cout << "3. Apply Pending Readings Now\n";
+    cout << "Enter choice: ";
+    int choice;
+    cin >> choice;
+
+    if(choice == 1) {
+        string file;
+        cout << CYAN << "Readings file or pipe path: " << RESET;
+        cin >> file;
+        cout << CYAN << "Replay readings already in the file? (y/n): " << RESET;
+        char replay;
+        cin >> replay;
+
+        if(sensorFeed.start(file, zones, replay == 'y' || replay == 'Y'))
+            cout << GREEN << "Feed started. Readings are applied between menu actions.\n" << RESET;
+        else
+            cout << RED << "Cannot open " << file << ".\n" << RESET;
+    } else if(choice == 2) {
+        sensorFeed.stop();
+        pollSensorFeed();
+        cout << GREEN << "Feed stopped.\n" << RESET;
+    } else if(choice == 3) {
+        cout << GREEN << pollSensorFeed() << " readings applied.\n" << RESET;
+    } else {
+        cout << RED << "Invalid choice.\n" << RESET;
+    }
+}
+
+/**********************************************************************************************
+HEADLESS ALERT FEED — OVERFLOW EARLY WARNINGS FOR SERVER USE
+Applies sensor readings as they arrive and prints one line whenever a zone enters or leaves
+the "full within N hours" window:
+  ALERT <yyyy-mm-dd hh:mm:ss> <ZONE> fill=<x>% eta=<minutes>m
+  CLEAR <yyyy-mm-dd hh:mm:ss> <ZONE> fill=<x>%
+**********************************************************************************************/
+static inline volatile sig_atomic_t alertFeedStop = 0;   // set by SIGINT / SIGTERM
+
+void runAlertFeed(const string& feedPath, int hours, int intervalSeconds, bool once) {
+    if(!feedPath.empty() && !sensorFeed.start(feedPath, zones, true, once)) {
+        cerr << "Cannot open sensor feed " << feedPath << "\n";
+        return;
+    }
+    // One report: every reading in the feed is applied before the first query
+    if(once && !feedPath.empty())
+        while(!sensorFeed.drained() && !alertFeedStop) this_thread::sleep_for(chrono::milliseconds(20));
+
+    auto stamp = []() {
+        time_t now = time(0);
+        char text[32];
+        strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", localtime(&now));
+        return string(text);
+    };
+
+    vector<char> alerted(zones.size(), 0), dueNow(zones.size(), 0);
+    vector<int> due;
+    bool errorReported = false;
+    while(!alertFeedStop) {
+        pollSensorFeed();
+        string readError = sensorFeed.readError();
+        if(!errorReported && !readError.empty()) {
+            cerr << "Sensor feed " << feedPath << ": " << readError << "; no further readings\n";
+            errorReported = true;
+        }
+        int now = OverflowEtaIndex::now();
+        overflowEta.dueBy(now + hours * 60, due);
+
+        fill(dueNow.begin(), dueNow.end(), 0);
+        for(int zid : due) {
+            dueNow[zid] = 1;
+            if(!alerted[zid])
+                cout << "ALERT " << stamp() << " " << zones[zid].name << " fill=" << zones[zid].currentWaste
+                     << "% eta=" << overflowEta.minutesLeft(zid, now) << "m\n";
+        }
+        for(int zid = 0; zid < (int)zones.size(); zid++)
+            if(alerted[zid] && !dueNow[zid])
+                cout << "CLEAR " << stamp() << " " << zones[zid].name << " fill=" << zones[zid].currentWaste << "%\n";
+        alerted.swap(dueNow);
+        cout.flush();
+
+        if(once) break;
+        for(int t = 0; t < intervalSeconds * 10 && !alertFeedStop; t++)
+            this_thread::sleep_for(chrono::milliseconds(100));
+    }
+
+    sensorFeed.stop();
+    pollSensorFeed();
+}
+
+/**********************************************************************************************
+WHAT-IF SCENARIO ENGINE
+Each scenario forks the pinned zone state as a ZoneOverlay, applies its spread events, growth
+and road closures there, then plans the capacity route on the result. Nothing live is written,
+so a batch of scenarios runs in parallel on the planner pool.
+**********************************************************************************************/
+ScenarioResult runScenario(const Scenario& s, const ZoneState& base) const {
+    ScenarioResult r;
+    r.name = s.name;
+    ZoneOverlay state(base);
+    int n = adj.size();
+
+    // Closed roads: a private copy of the network without them
+    vector<vector<Edge>> openRoads;
+    if(!s.closedRoads.empty()) {
+        openRoads = adj;
+        auto close = [&](int u, int v) {
+            if(u < 0 || u >= n) return;
+            auto& edges = openRoads[u];
+            edges.erase(remove_if(edges.begin(), edges.end(), [v](const Edge& e) { return e.to == v; }),
+                        edges.end());
+        };
+        for(auto& road : s.closedRoads) {
+            close(road.first, road.second);
+            close(road.second, road.first);
+        }
+    }
+    const vector<vector<Edge>>& roads = s.closedRoads.empty() ? adj : openRoads;
+
+    if(!s.spreadOrigins.empty()) {
+        vector<int> level(base.size(), -1);
+        multiSourceBfs(roads, s.spreadOrigins, level.data(), plannerPool());
+        for(int u = 0; u < base.size(); u++)
+            if(level[u] > 0) state.setWaste(u, state.waste(u) + level[u] * 10);
+    }
+
+    // Same growth as simulateWasteGeneration(), with the 0-4 noise term at its mean of 2
+    // so that scenarios compare like for like
+    for(int d = 0; d < s.days; d++)
+        for(int u = 0; u < base.size(); u++)
+            if(!state.isDepot(u)) {
+                int w = state.waste(u);
+                state.setWaste(u, w + (int)(w * s.growthRate) + 2);
+            }
+
+    for(int u = 0; u < base.size(); u++) {
+        int w = state.waste(u);
+        r.totalWaste += w;
+        if(w >= 100) r.overflowing++;
+        if(w > 80) r.critical++;
+    }
+    r.changedLevels = state.changedCount();
+
+    // Capacity route over the same zones capacityRoute() empties on the live data: every zone
+    // that is not a yard or transfer station
+    VisitedMask open(n);
+    vector<int> fill(n);
+    int pending = 0;
+    for(int u = 0; u < base.size(); u++) {
+        bool collect = !state.isDepot(u);
+        if(u >= n) {
+            r.unreached += collect;     // zone added later, off the road network
+            continue;
+        }
+        fill[u] = state.waste(u);
+        if(!collect) open.set(u);
+        else pending++;
+    }
+
+    PathKernel kernel = choosePathKernel(roadMaxWeight);
+    CapacityTour tour = capacityTour(routeStartZone(), open, fill, [&](int u, int* row) {
+        if(s.closedRoads.empty()) matrixRow(u, row);
+        else shortestPaths(roads, u, roadMaxWeight, kernel, row);
+    });
+    r.routeKm = tour.km;
+    r.yardTrips = tour.yardTrips;
+    r.stops = tour.served;
+
+    r.unreached += pending - r.stops;
+    r.cost = RouteEvaluator::fuelCost(r.routeKm);
+    return r;
+}
+
+// Every scenario in the batch sees the same pinned version of the zones
+vector<ScenarioResult> runScenarios(const vector<Scenario>& scenarios) {
+    auto snap = pinZoneState();
+    vector<ScenarioResult> results(scenarios.size());
+    plannerPool().parallelFor(0, scenarios.size(), 1, [&](int lo, int hi) {
+        for(int i = lo; i < hi; i++) results[i] = runScenario(scenarios[i], *snap);
+    });
+    return results;
+}
+
+// Zone id from an exact or unique partial name (-1 if none or ambiguous)
+int resolveZone(string name) {
+    for(char& c : name) c = toupper(c);
+    name.erase(0, name.find_first_not_of(' '));
+    name.erase(name.find_last_not_of(' ') + 1);
+    if(name.empty()) return -1;
+    if(id.count(name)) return id[name];
+    vector<int> matches = lookupTable.findAllMatches(name);
+    return matches.size() == 1 ? matches[0] : -1;
+}
+
+void printScenarioTable(const ScenarioResult& baseline, vector<ScenarioResult> results, int limit) {
+    cout << left << setw(COLUMN_WIDTH) << "SCENARIO"
+         << setw(9) << "KM" << setw(9) << "+KM" << setw(12) << "COST (Rs)"
+         << setw(7) << "STOPS" << setw(7) << "TRIPS" << setw(9) << "UNREACH"
+         << setw(10) << "OVERFLOW" << setw(10) << "CRITICAL" << "CHANGED\n";
+    cout << string(COLUMN_WIDTH + 82, '-') << "\n";
+
+    auto row = [&](const ScenarioResult& r, const char* col) {
+        long long extra = r.routeKm - baseline.routeKm;
+        cout << col << left << setw(COLUMN_WIDTH) << r.name.substr(0, COLUMN_WIDTH - 1)
+             << setw(9) << r.routeKm << setw(9) << ((extra > 0 ? "+" : "") + to_string(extra))
+             << setw(12) << fixed << setprecision(2) << r.cost
+             << setw(7) << r.stops << setw(7) << r.yardTrips << setw(9) << r.unreached
+             << setw(10) << r.overflowing << setw(10) << r.critical << r.changedLevels << RESET << "\n";
+    };
 
-    if(count <= 0 || count > zones.size()) {
-        cout << RED << "Invalid count.\n" << RESET;
-        return;
+    row(baseline, CYAN);
+    for(int i = 0; i < (int)results.size() && i < limit; i++) {
+        const ScenarioResult& r = results[i];
+        const char* col = r.overflowing > baseline.overflowing || r.unreached > baseline.unreached ? RED
+                        : r.routeKm > baseline.routeKm ? YELLOW : GREEN;
+        row(r, col);
     }
+    if((int)results.size() > limit)
+        cout << YELLOW << "... " << results.size() - limit << " more scenario(s) not shown\n" << RESET;
+}
 
-    int updated = 0;
+void whatIfScenarios() {
+    system("cls");
+    publishZoneState();
+    uint64_t version = pinZoneState()->version;
+
+    cout << BLUE << "=============== WHAT-IF SCENARIOS ===============\n" << RESET;
+    cout << "Scenarios fork zone state version " << version << "; live zones are not modified.\n\n";
+    cout << "1. Outbreak Origin Sweep (spread from each zone in turn)\n";
+    cout << "2. Road Closure Sweep (close each road in turn)\n";
+    cout << "3. Growth Rate Sweep (0-20% per day)\n";
+    cout << "4. Custom Scenario\n";
+    cout << "Enter choice: ";
+    int choice;
+    cin >> choice;
 
-    for(int i = 0; i < count; i++) {
+    vector<Scenario> batch;
+    int n = adj.size();
 
+    if(choice == 1) {
+        for(int u = 0; u < n; u++)
+            if(!zones[u].isDepot) {
+                Scenario s;
+                s.name = "Spread from " + zones[u].name;
+                s.spreadOrigins.push_back(u);
+                batch.push_back(s);
+            }
+    } else if(choice == 2) {
+        for(int u = 0; u < n; u++)
+            for(auto& e : adj[u])
+                if(u < e.to) {
+                    Scenario s;
+                    s.name = "Close " + zones[u].name + "-" + zones[e.to].name;
+                    s.closedRoads.push_back({u, e.to});
+                    batch.push_back(s);
+                }
+    } else if(choice == 3) {
+        int days;
+        cout << CYAN << "Number of days: " << RESET;
+        cin >> days;
+        if(days < 1 || days > 365) {
+            cout << RED << "Invalid number of days.\n" << RESET;
+            return;
+        }
+        for(int rate = 0; rate <= 20; rate += 2) {
+            Scenario s;
+            s.name = to_string(rate) + "% daily x " + to_string(days) + " days";
+            s.growthRate = rate / 100.0;
+            s.days = days;
+            batch.push_back(s);
+        }
+    } else if(choice == 4) {
+        Scenario s;
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        cout << "\nZone " << (i + 1) << ":\n";
-        cout << CYAN << "Enter zone name (partial or full): " << RESET;
-        string input;
-        getline(cin, input);
-
-        for(char &c : input) c = toupper(c);
+        cout << CYAN << "Scenario name: " << RESET;
+        getline(cin, s.name);
+        if(s.name.empty()) s.name = "Custom";
+
+        string line, token;
+        cout << CYAN << "Spread origins (comma separated, blank for none): " << RESET;
+        getline(cin, line);
+        stringstream origins(line);
+        while(getline(origins, token, ',')) {
+            if(token.find_first_not_of(' ') == string::npos) continue;
+            int z = resolveZone(token);
+            if(z == -1) {
+                cout << RED << "Unknown or ambiguous zone: " << token << "\n" << RESET;
+                return;
+            }
+            s.spreadOrigins.push_back(z);
+        }
 
-        vector<int> matches;
-        for(int z = 0; z < zones.size(); z++){
-            string temp = zones[z].name;
-            for(char &c : temp) c = toupper(c);
-            if(temp.find(input) != string::npos){
-                matches.push_back(z);
+        cout << CYAN << "Closed roads (ZONE_A-ZONE_B, comma separated, blank for none): " << RESET;
+        getline(cin, line);
+        stringstream roads(line);
+        while(getline(roads, token, ',')) {
+            if(token.find_first_not_of(' ') == string::npos) continue;
+            size_t dash = token.find('-');
+            int a = dash == string::npos ? -1 : resolveZone(token.substr(0, dash));
+            int b = dash == string::npos ? -1 : resolveZone(token.substr(dash + 1));
+            if(a == -1 || b == -1) {
+                cout << RED << "Cannot read road: " << token << "\n" << RESET;
+                return;
             }
+            s.closedRoads.push_back({a, b});
         }
 
-        if(matches.empty()){
-            cout << YELLOW << "No matching zone found. Skipping.\n" << RESET;
-            continue;
+        double rate;
+        cout << CYAN << "Daily growth rate percentage (0-20): " << RESET;
+        cin >> rate;
+        cout << CYAN << "Number of days: " << RESET;
+        cin >> s.days;
+        if(rate < 0 || rate > 20 || s.days < 0 || s.days > 365) {
+            cout << RED << "Invalid growth settings.\n" << RESET;
+            return;
         }
+        s.growthRate = rate / 100.0;
+        batch.push_back(s);
+    } else {
+        cout << RED << "Invalid choice.\n" << RESET;
+        return;
+    }
 
-        int zid;
-        if(matches.size() > 1){
-            cout << YELLOW << "Multiple matches found, choose one:" << RESET << "\n";
-            for(int j = 0; j < matches.size(); j++)
-                cout << (j + 1) << ". " << zones[matches[j]].name << "\n";
+    if(batch.empty()) {
+        cout << YELLOW << "No scenarios to run.\n" << RESET;
+        return;
+    }
 
-            int ch;
-            cout << CYAN << "Enter choice: " << RESET;
-            cin >> ch;
+    Scenario baseline;
+    baseline.name = "Baseline (current state)";
+    batch.insert(batch.begin(), baseline);
 
-            if(ch < 1 || ch > matches.size()){
-                cout << RED << "Invalid choice. Skipping.\n" << RESET;
-                continue;
-            }
-            zid = matches[ch - 1];
-        }
-        else {
-            zid = matches[0];
-        }
+    auto t0 = chrono::steady_clock::now();
+    vector<ScenarioResult> results = runScenarios(batch);
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
 
-        cout << "Current waste: " << zones[zid].currentWaste << "%\n";
-        cout << CYAN << "Enter new waste level (0-100): " << RESET;
-        int newWaste;
-        cin >> newWaste;
+    ScenarioResult base = results[0];
+    results.erase(results.begin());
 
-        if(newWaste >= 0 && newWaste <= 100){
-            zones[zid].currentWaste = newWaste;
-            zones[zid].history.push_back(newWaste);
-            updated++;
-            cout << GREEN << "Updated successfully.\n" << RESET;
-        }
-        else{
-            cout << RED << "Invalid waste level. Skipped.\n" << RESET;
-        }
-    }
+    // Worst first: overflow, then unreachable zones, then route length
+    stable_sort(results.begin(), results.end(), [](const ScenarioResult& a, const ScenarioResult& b) {
+        if(a.overflowing != b.overflowing) return a.overflowing > b.overflowing;
+        if(a.unreached != b.unreached) return a.unreached > b.unreached;
+        return a.routeKm > b.routeKm;
+    });
 
-    cout << GREEN << "\nBatch update complete. " << updated << " zones updated.\n" << RESET;
+    cout << GREEN << "\n" << batch.size() << " scenario(s) evaluated in " << fixed << setprecision(2) << ms
+         << " ms on " << plannerPool().threads() << " thread(s).\n\n" << RESET;
+    printScenarioTable(base, results, 10);
+
+    cout << "\nLive zone state is still version " << pinZoneState()->version << ".\n";
 }
 
 /**********************************************************************************************
@@ -2143,6 +7759,8 @@ void advancedZoneSearch(){
     cin >> filterType;
 
     vector<int> results;
+    auto snap = pinZoneState();
+    const vector<int>& waste = snap->waste;
 
     switch(filterType) {
         case 1: {
@@ -2152,11 +7770,8 @@ void advancedZoneSearch(){
             cout << CYAN << "Enter maximum waste level: " << RESET;
             cin >> maxWaste;
 
-            for(int i = 0; i < zones.size(); i++) {
-                if(zones[i].currentWaste >= minWaste && zones[i].currentWaste <= maxWaste) {
-                    results.push_back(i);
-                }
-            }
+            snap->inRange(minWaste, maxWaste, results);
+            sort(results.begin(), results.end());
             break;
         }
         case 2: {
@@ -2164,8 +7779,8 @@ void advancedZoneSearch(){
             cout << CYAN << "Enter minimum priority: " << RESET;
             cin >> priority;
 
-            for(int i = 0; i < zones.size(); i++) {
-                if(zones[i].priority >= priority) {
+            for(int i = 0; i < snap->size(); i++) {
+                if(snap->priority[i] >= priority) {
                     results.push_back(i);
                 }
             }
@@ -2181,11 +7796,8 @@ void advancedZoneSearch(){
             break;
         }
         case 4: {
-            for(int i = 0; i < zones.size(); i++) {
-                if(zones[i].currentWaste > 80) {
-                    results.push_back(i);
-                }
-            }
+            snap->inRange(81, 100, results);
+            sort(results.begin(), results.end());
             break;
         }
         default:
@@ -2205,13 +7817,14 @@ void advancedZoneSearch(){
     cout << "--------------------------------------------------------------\n";
 
     for(int zid : results) {
+        if(zid >= snap->size()) continue;      // name match on a zone added after this version
         string col = GREEN;
-        if(zones[zid].currentWaste > 80) col = RED;
-        else if(zones[zid].currentWaste > 50) col = YELLOW;
+        if(waste[zid] > 80) col = RED;
+        else if(waste[zid] > 50) col = YELLOW;
 
         cout << left << setw(COLUMN_WIDTH) << zones[zid].name
-             << col << setw(15) << zones[zid].currentWaste << "%" << RESET
-             << zones[zid].priority << "\n";
+             << col << setw(15) << waste[zid] << "%" << RESET
+             << snap->priority[zid] << "\n";
     }
 
     cout << "--------------------------------------------------------------\n";
@@ -2224,27 +7837,30 @@ void routeEfficiencyCalculator(){
     system("cls");
     cout << BLUE << "=============== ROUTE EFFICIENCY CALCULATOR ===============\n" << RESET;
 
-    if(savedRoutes.empty()) {
+    if(routeStore.empty()) {
         cout << YELLOW << "No saved routes available. Generate routes first.\n" << RESET;
         return;
     }
 
-    cout << CYAN << "Select route number (1-" << savedRoutes.size() << "): " << RESET;
+    cout << CYAN << "Select route number (1-" << routeStore.size() << "): " << RESET;
     int routeNum;
     cin >> routeNum;
 
-    if(routeNum < 1 || routeNum > savedRoutes.size()) {
+    if(routeNum < 1 || routeNum > routeStore.size()) {
         cout << RED << "Invalid route number.\n" << RESET;
         return;
     }
 
-    Route& r = savedRoutes[routeNum - 1];
+    Route r = routeStore.load(routeNum - 1);
 
     if(r.path.empty()) {
         cout << RED << "Route is empty.\n" << RESET;
         return;
     }
 
+    RouteEvaluator eval(zones, dist);
+    eval.assign(r.path);
+
     double avgWastePerKm = (double)r.totalWaste / max(1.0, (double)r.totalDistance);
     double costPerWaste  = r.totalCost / max(1.0, (double)r.totalWaste);
     double efficiency    = (double)r.totalWaste / max(1.0, r.totalCost);
@@ -2255,11 +7871,52 @@ void routeEfficiencyCalculator(){
     cout << left << setw(35) << "Total Cost:" << "Rs. " << fixed << setprecision(2) << r.totalCost << "\n";
     cout << left << setw(35) << "Total Waste Collected:" << r.totalWaste << " units\n";
     cout << left << setw(35) << "Number of Stops:" << r.path.size() << "\n";
+    cout << left << setw(35) << "Driving + Service Time:" << eval.minutes() / 60 << " h "
+         << eval.minutes() % 60 << " min\n";
     cout << "\n" << CYAN << "EFFICIENCY INDICATORS:\n" << RESET;
     cout << left << setw(35) << "Waste per Kilometer:" << fixed << setprecision(3) << avgWastePerKm << " units/km\n";
     cout << left << setw(35) << "Cost per Waste Unit:" << "Rs. " << fixed << setprecision(2) << costPerWaste << "\n";
     cout << left << setw(35) << "Efficiency Ratio:" << fixed << setprecision(3) << efficiency << " units/Rs.\n";
 
+    // Detour analysis: every single-move edit of the route, each priced in O(1)
+    int n = eval.size();
+    int costliestStop = -1;
+    long long costliestSaving = 0;
+    for(int i = 1; i < n; i++) {
+        if(-eval.removeDelta(i) > costliestSaving) {
+            costliestSaving = -eval.removeDelta(i);
+            costliestStop = i;
+        }
+    }
+
+    long long bestReverse = 0, bestSwap = 0;
+    int ri = -1, rj = -1, si = -1, sj = -1;
+    for(int i = 1; i < n; i++) {
+        for(int j = i + 1; j < n; j++) {
+            long long rd = eval.reverseDelta(i, j);
+            if(rd < bestReverse) { bestReverse = rd; ri = i; rj = j; }
+            long long sd = eval.swapDelta(i, j);
+            if(sd < bestSwap) { bestSwap = sd; si = i; sj = j; }
+        }
+    }
+
+    cout << "\n" << CYAN << "DETOUR ANALYSIS:\n" << RESET;
+    if(costliestStop != -1) {
+        cout << left << setw(35) << "Costliest Stop:" << zones[r.path[costliestStop]].name
+             << " (skipping it saves " << costliestSaving << " km)\n";
+    }
+    if(ri != -1) {
+        cout << left << setw(35) << "Best Segment Reversal:" << "stops " << ri + 1 << "-" << rj + 1
+             << " saves " << -bestReverse << " km\n";
+    }
+    if(si != -1) {
+        cout << left << setw(35) << "Best Stop Swap:" << zones[r.path[si]].name << " <-> "
+             << zones[r.path[sj]].name << " saves " << -bestSwap << " km\n";
+    }
+    if(ri == -1 && si == -1) {
+        cout << GREEN << "No single reversal or swap shortens this route.\n" << RESET;
+    }
+
     string rating;
     string ratingColor;
     if(efficiency > 5.0) {
@@ -2314,18 +7971,37 @@ void simulateWasteGeneration(){
         initialWaste[i] = zones[i].currentWaste;
     }
 
-    for(int day = 1; day <= days; day++) {
-        for(int i = 0; i < zones.size(); i++) {
-            if(zones[i].id != dumpingYard) {
-                int increase = (int)(zones[i].currentWaste * growthRate) + (rand() % 5);
+    // Zones evolve independently, so each zone runs all its days as one pool task. rand() is
+    // not thread-safe: every zone gets its own generator, seeded here on this thread.
+    // Simulated days follow today, or the zone's last recorded day if that is later.
+    vector<unsigned> seeds(zones.size());
+    for(unsigned& seed : seeds) seed = rand();
+    int today = WasteForecaster::today();
+    vector<int> firstDay(zones.size());
+    vector<int> simulated((size_t)zones.size() * days);
+
+    plannerPool().parallelFor(0, zones.size(), 8, [&](int lo, int hi) {
+        for(int i = lo; i < hi; i++) {
+            if(zones[i].isDepot) continue;
+            mt19937 rng(seeds[i]);
+            firstDay[i] = max(zones[i].historyDay, today) + 1;
+            for(int day = 1; day <= days; day++) {
+                int increase = (int)(zones[i].currentWaste * growthRate) + (rng() % 5);
                 zones[i].currentWaste = min(100, zones[i].currentWaste + increase);
-                zones[i].history.push_back(zones[i].currentWaste);
-                if(zones[i].history.size() > MAX_HISTORY_SIZE) {
-                    zones[i].history.erase(zones[i].history.begin());
-                }
+                recordDailyLevel(zones[i], zones[i].currentWaste, firstDay[i] + day - 1);
+                simulated[(size_t)i * days + day - 1] = zones[i].currentWaste;
             }
         }
+    });
+
+    // The forecaster is not thread-safe: fold the simulated days in here, then rebuild the
+    // indexes (overflow ETAs included) from the updated model
+    for(int i = 0; i < (int)zones.size(); i++) {
+        if(zones[i].isDepot) continue;
+        for(int day = 0; day < days; day++)
+            forecaster.observe(i, simulated[(size_t)i * days + day], firstDay[i] + day);
     }
+    rebuildFillIndexes();
 
     cout << left << setw(COLUMN_WIDTH) << "ZONE NAME"
          << setw(15) << "INITIAL"
@@ -2334,7 +8010,7 @@ void simulateWasteGeneration(){
     cout << "--------------------------------------------------------------\n";
 
     for(int i = 0; i < zones.size(); i++) {
-        if(zones[i].id != dumpingYard) {
+        if(!zones[i].isDepot) {
             int change = zones[i].currentWaste - initialWaste[i];
             string changeStr = (change > 0 ? "+" : "") + to_string(change);
             string changeCol = (change > 20) ? RED : (change > 0) ? YELLOW : GREEN;
@@ -2415,6 +8091,786 @@ void exportGraphData(){
     cout << YELLOW << "\nNote: This is display-only. For file export, implement file I/O.\n" << RESET;
 }
 
+/**********************************************************************************************
+PERFORMANCE BENCHMARKS
+**********************************************************************************************/
+// Greedy nearest-unvisited tour over a matrix; 'vectorized' picks the SIMD kernel or the
+// plain element-wise scan the route builders used before
+static long long benchmarkGreedyBuild(const DistanceMatrix& m, bool vectorized, vector<int>& order) {
+    int n = m.size();
+    order.assign(1, 0);
+    long long total = 0;
+    int cur = 0;
+
+    if(vectorized) {
+        VisitedMask vis(n);
+        vis.set(0);
+        for(int step = 1; step < n; step++) {
+            int best;
+            int nxt = nearestUnvisited(m[cur], vis, best);
+            if(nxt == -1) break;
+            total += best;
+            vis.set(nxt); order.push_back(nxt); cur = nxt;
+        }
+    } else {
+        vector<int> vis(n, 0);
+        vis[0] = 1;
+        for(int step = 1; step < n; step++) {
+            int nxt = -1, best = INF;
+            DistanceMatrix::RowView row = m[cur];
+            for(int i = 0; i < n; i++)
+                if(!vis[i] && row[i] < best)
+                    best = row[i], nxt = i;
+            if(nxt == -1) break;
+            total += best;
+            vis[nxt] = 1; order.push_back(nxt); cur = nxt;
+        }
+    }
+    return total;
+}
+
+void benchmarkRouteBuild() {
+    int n;
+    cout << CYAN << "Number of synthetic stops (e.g. 10000): " << RESET;
+    cin >> n;
+    if(n < 2 || n > 30000) {
+        cout << RED << "Stop count must be between 2 and 30000.\n" << RESET;
+        return;
+    }
+
+    // Random stops on a 300 km x 300 km grid, straight-line km (fits the 16-bit layout)
+    mt19937 rng(2024);
+    vector<int> px(n), py(n);
+    for(int i = 0; i < n; i++) {
+        px[i] = rng() % 300;
+        py[i] = rng() % 300;
+    }
+    DistanceMatrix m;
+    auto buildStart = chrono::steady_clock::now();
+    m.generate(n, [&](int i, int j) {
+        int dx = px[i] - px[j], dy = py[i] - py[j];
+        return (int)lround(sqrt((double)(dx * dx + dy * dy)));
+    });
+    double buildSec = chrono::duration<double>(chrono::steady_clock::now() - buildStart).count();
+
+    cout << BLUE << "=============== ROUTE BUILD BENCHMARK ===============\n" << RESET;
+    cout << "Stops: " << n << "   Matrix: " << m.memoryBytes() / (1024 * 1024) << " MB ("
+         << (m.isNarrow() ? "16-bit" : "32-bit") << " cells), built in "
+         << fixed << setprecision(2) << buildSec << " s\n";
+#if defined(__AVX512BW__)
+    cout << "Kernel: AVX-512BW (32 zones per instruction)\n";
+#elif defined(__AVX2__)
+    cout << "Kernel: AVX2 (16 zones per instruction)\n";
+#else
+    cout << YELLOW << "Kernel: scalar fallback (compile with -march=native for SIMD)\n" << RESET;
+#endif
+
+    vector<int> scalarOrder, simdOrder;
+    auto t0 = chrono::steady_clock::now();
+    long long scalarKm = benchmarkGreedyBuild(m, false, scalarOrder);
+    auto t1 = chrono::steady_clock::now();
+    long long simdKm = benchmarkGreedyBuild(m, true, simdOrder);
+    auto t2 = chrono::steady_clock::now();
+
+    double scalarMs = chrono::duration<double, milli>(t1 - t0).count();
+    double simdMs = chrono::duration<double, milli>(t2 - t1).count();
+
+    cout << "--------------------------------------------------------------\n";
+    cout << left << setw(22) << "Element-wise scan" << setw(12) << (to_string((long long)scalarMs) + " ms")
+         << scalarKm << " km\n";
+    cout << left << setw(22) << "Masked argmin" << setw(12) << (to_string((long long)simdMs) + " ms")
+         << simdKm << " km\n";
+    cout << "--------------------------------------------------------------\n";
+    cout << "Speedup: " << fixed << setprecision(2) << scalarMs / max(simdMs, 0.001) << "x\n";
+    if(scalarOrder == simdOrder) cout << GREEN << "Both builders produced the same route.\n" << RESET;
+    else cout << RED << "Route mismatch between builders!\n" << RESET;
+}
+
+// Puts live zone data back after a benchmark fed it synthetic readings
+void restoreZones(const vector<Zone>& saved) {
+    zones = saved;
+    for(int i = 0; i < (int)zones.size(); i++) {
+        delete segmentTrees[i];
+        segmentTrees[i] = new SegmentTree(zones[i].history);
+    }
+    forecaster.fit(zones, plannerPool());
+    rebuildFillIndexes();
+    publishZoneState();
+}
+
+void benchmarkSensorIngest() {
+    int n;
+    cout << CYAN << "Number of synthetic readings (e.g. 1000000): " << RESET;
+    cin >> n;
+    if(n < 1 || n > 50000000) {
+        cout << RED << "Reading count must be between 1 and 50000000.\n" << RESET;
+        return;
+    }
+
+    // A new file in the temp directory, so no file of the user's is overwritten
+    error_code ec;
+    filesystem::path dir = filesystem::temp_directory_path(ec);
+    if(ec) dir = ".";
+    mt19937_64 pick(random_device{}() ^ (uint64_t)chrono::steady_clock::now().time_since_epoch().count());
+    string file;
+    do file = (dir / ("sensor_bench_" + to_string(pick()) + ".txt")).string();
+    while(filesystem::exists(file, ec));
+    {
+        ofstream out(file);
+        if(!out) {
+            cout << RED << "Cannot create " << file << "\n" << RESET;
+            return;
+        }
+        mt19937 rng(7);
+        for(int i = 0; i < n; i++) {
+            int z = rng() % zones.size();
+            // Mix numeric ids and names, like a fleet with old and new sensor firmware
+            if(i % 4 == 0) out << zones[z].name << " " << rng() % 101 << "\n";
+            else out << z << " " << rng() % 101 << "\n";
+        }
+    }
+
+    vector<Zone> savedZones = zones;
+    long long appliedBefore = sensorApplied, batchesBefore = sensorBatches;
+    SensorFeed bench;
+    long long applied = 0;
+    auto t0 = chrono::steady_clock::now();
+    if(!bench.start(file, zones, true, true)) {
+        cout << RED << "Cannot open " << file << "\n" << RESET;
+        remove(file.c_str());
+        return;
+    }
+    while(true) {
+        bool done = bench.drained();          // checked first: everything before it is queued
+        auto batches = bench.take();
+        for(auto& b : batches) {
+            applySensorBatch(b);
+            applied += b.size();
+        }
+        if(done && batches.empty()) break;
+        if(batches.empty()) this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    double sec = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    long long rejectedLines = bench.readingsRejected();
+    bench.stop();
+    remove(file.c_str());
+
+    restoreZones(savedZones);
+    sensorApplied = appliedBefore;
+    sensorBatches = batchesBefore;
+
+    cout << BLUE << "=============== SENSOR INGEST BENCHMARK ===============\n" << RESET;
+    cout << "Readings: " << n << "   Batch size: " << SensorFeed::BATCH_SIZE << "\n";
+    cout << "Applied: " << applied << "   Rejected lines: " << rejectedLines << "\n";
+    cout << "Parse + apply time: " << fixed << setprecision(3) << sec << " s\n";
+    cout << "Throughput: " << (long long)(n / max(sec, 1e-9)) << " readings/sec\n";
+}
+
+void benchmarkSnapshotReaders() {
+    int readers, seconds;
+    cout << CYAN << "Reader threads (1-" << EpochSnapshot<ZoneState>::MAX_READERS << "): " << RESET;
+    cin >> readers;
+    cout << CYAN << "Duration in seconds: " << RESET;
+    cin >> seconds;
+    readers = max(1, min(readers, EpochSnapshot<ZoneState>::MAX_READERS));
+    seconds = max(1, min(seconds, 60));
+
+    vector<Zone> savedZones = zones;
+    long long reclaimedBefore = zoneState.reclaimed();
+
+    atomic<bool> stopReaders{false};
+    atomic<long long> reads{0}, torn{0};
+    vector<thread> pool;
+    for(int t = 0; t < readers; t++) {
+        pool.emplace_back([&]() {
+            long long local = 0, bad = 0;
+            uint64_t lastVersion = 0;
+            while(!stopReaders) {
+                auto snap = pinZoneState();
+                long long sum = 0;
+                for(int w : snap->waste) sum += w;
+                if(sum != snap->totalWaste || snap->version < lastVersion) bad++;
+                lastVersion = snap->version;
+                local++;
+            }
+            reads += local;
+            torn += bad;
+        });
+    }
+
+    // Writer: synthetic sensor batches applied and published as fast as possible
+    mt19937 rng(11);
+    long long versions = 0;
+    vector<SensorFeed::Reading> batch(SensorFeed::BATCH_SIZE);
+    auto t0 = chrono::steady_clock::now();
+    auto deadline = t0 + chrono::seconds(seconds);
+    while(chrono::steady_clock::now() < deadline) {
+        for(auto& r : batch) {
+            r.zone = rng() % zones.size();
+            r.level = rng() % 101;
+        }
+        applySensorBatch(batch);
+        publishZoneState();
+        versions++;
+    }
+    stopReaders = true;
+    for(auto& th : pool) th.join();
+    double sec = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+    long long appliedBefore = sensorApplied - versions * SensorFeed::BATCH_SIZE;
+    restoreZones(savedZones);
+    sensorApplied = appliedBefore;
+    sensorBatches -= versions;
+
+    cout << BLUE << "=============== SNAPSHOT READERS BENCHMARK ===============\n" << RESET;
+    cout << "Reader threads: " << readers << "   Duration: " << fixed << setprecision(2) << sec << " s\n";
+    cout << "Versions published: " << versions << " (" << (long long)(versions / sec) << "/sec)\n";
+    cout << "Snapshot reads: " << reads << " (" << (long long)(reads / sec) << "/sec)\n";
+    cout << "Versions reclaimed: " << zoneState.reclaimed() - reclaimedBefore
+         << "   awaiting reclaim: " << zoneState.pendingReclaim() << "\n";
+    if(torn == 0) cout << GREEN << "Every read saw a complete, in-order version.\n" << RESET;
+    else cout << RED << torn << " inconsistent reads!\n" << RESET;
+}
+
+void benchmarkScheduler() {
+    int side;
+    cout << CYAN << "Grid side for the APSP test (e.g. 24 -> 576 nodes): " << RESET;
+    cin >> side;
+    side = max(4, min(side, 48));
+    int n = side * side;
+
+    // Synthetic road grid, 1-9 km per block
+    mt19937 rng(99);
+    vector<int> base((size_t)n * n, INF);
+    for(int i = 0; i < n; i++) base[(size_t)i * n + i] = 0;
+    for(int r = 0; r < side; r++)
+        for(int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if(c + 1 < side) base[(size_t)u * n + u + 1] = base[(size_t)(u + 1) * n + u] = 1 + rng() % 9;
+            if(r + 1 < side) base[(size_t)u * n + u + side] = base[(size_t)(u + side) * n + u] = 1 + rng() % 9;
+        }
+
+    vector<int> counts = {1};
+    int hw = max(1u, thread::hardware_concurrency());
+    for(int t = 2; t < hw; t *= 2) counts.push_back(t);
+    if(hw > 1) counts.push_back(hw);
+
+    cout << BLUE << "=============== WORK-STEALING SCHEDULER SCALING ===============\n" << RESET;
+    cout << "Hardware threads: " << hw << "   APSP nodes: " << n << "\n";
+    cout << left << setw(10) << "THREADS" << setw(16) << "APSP (ms)" << setw(16) << "REDUCE (ms)"
+         << setw(12) << "SPEEDUP" << "STEALS\n";
+    cout << "--------------------------------------------------------------\n";
+
+    double baseline = 0;
+    long long checksum = -1;
+    for(int t : counts) {
+        WorkStealingPool pool(t);
+
+        vector<int> d = base;
+        auto t0 = chrono::steady_clock::now();
+        parallelFloydWarshall(d, n, nullptr, pool);
+        auto t1 = chrono::steady_clock::now();
+
+        // parallel_reduce over the result: sum of all finite shortest distances
+        long long sum = pool.parallelReduce(0, n, 16, 0LL,
+            [&](int lo, int hi) {
+                long long s = 0;
+                for(size_t k = (size_t)lo * n; k < (size_t)hi * n; k++) if(d[k] != INF) s += d[k];
+                return s;
+            },
+            [](long long a, long long b) { return a + b; });
+        auto t2 = chrono::steady_clock::now();
+
+        double apspMs = chrono::duration<double, milli>(t1 - t0).count();
+        double reduceMs = chrono::duration<double, milli>(t2 - t1).count();
+        if(t == 1) baseline = apspMs;
+        if(checksum == -1) checksum = sum;
+
+        cout << left << setw(10) << t << setw(16) << fixed << setprecision(1) << apspMs
+             << setw(16) << setprecision(2) << reduceMs
+             << setw(12) << (to_string(baseline / max(apspMs, 1e-6)).substr(0, 4) + "x")
+             << pool.stealCount() << (sum != checksum ? "  MISMATCH" : "") << "\n";
+    }
+    cout << "--------------------------------------------------------------\n";
+    cout << "Sum of all-pairs distances: " << checksum << " km\n";
+    if(hw == 1) cout << YELLOW << "Only one hardware thread available: no speedup is possible here.\n" << RESET;
+}
+
+void benchmarkScratchArena() {
+    int reps;
+    cout << CYAN << "Repetitions per query (e.g. 2000): " << RESET;
+    cin >> reps;
+    reps = max(1, min(reps, 1000000));
+    int n = zones.size();
+    if(n < 2) {
+        cout << RED << "Need at least two zones.\n" << RESET;
+        return;
+    }
+
+    vector<Zone> work = zones;   // merge sort runs on a copy so live data keeps its order
+    vector<int> allStops, targets;
+    for(int i = 1; i < n; i++) if(!zones[i].isDepot) allStops.push_back(i);
+    targets.reserve(allStops.size());
+    long long sink = 0;
+    int src = 0;
+    vector<int> origin(1);
+    bool byWaste = true;
+
+    struct Query {
+        string name;
+        function<void()> run;
+    };
+    vector<Query> queries = {
+        {"Dijkstra (one source)", [&]() {
+            ArenaScope scope;
+            pmr::vector<int> d = dijkstra(src);
+            sink += d[n - 1];
+            src = (src + 1) % n;
+        }},
+        {"BFS levels", [&]() {
+            ArenaScope scope;
+            pmr::vector<int> level(adj.size(), scratchResource());
+            origin[0] = src;
+            BfsStats stats = multiSourceBfs(adj, origin, level.data(), plannerPool());
+            sink += stats.levels;
+            src = (src + 1) % n;
+        }},
+        {"Merge sort (zones)", [&]() {
+            SortingAlgorithms::mergeSort(work, 0, n - 1, byWaste);
+            byWaste = !byWaste;
+            sink += work[0].id;
+        }},
+        {"Greedy route (CH table)", [&]() {
+            targets.assign(allStops.begin(), allStops.end());
+            Route r = optimizedRouteGreedy(0, targets);
+            sink += r.totalDistance;
+        }},
+    };
+
+    cout << BLUE << "=============== SCRATCH ARENA: HEAP ALLOCATIONS ===============\n" << RESET;
+    cout << "Zones: " << n << "   Repetitions: " << reps << "\n";
+    cout << left << setw(26) << "QUERY" << setw(14) << "HEAP allocs" << setw(14) << "ARENA allocs"
+         << setw(12) << "HEAP (us)" << "ARENA (us)\n";
+    cout << "--------------------------------------------------------------\n";
+
+    for(auto& q : queries) {
+        double allocs[2], micros[2];
+        for(int mode = 0; mode < 2; mode++) {
+            scratchArenaEnabled = (mode == 1);
+            q.run();   // warm-up: lets the arena and CH bucket lists reach their peak size
+            long long before = heapAllocationCount();
+            auto t0 = chrono::steady_clock::now();
+            for(int r = 0; r < reps; r++) q.run();
+            auto t1 = chrono::steady_clock::now();
+            allocs[mode] = double(heapAllocationCount() - before) / reps;
+            micros[mode] = chrono::duration<double, micro>(t1 - t0).count() / reps;
+        }
+        bool counted = heapAllocationCount() >= 0;
+        cout << left << setw(26) << q.name << fixed << setprecision(1);
+        if(counted) cout << setw(14) << allocs[0] << setw(14) << allocs[1];
+        else cout << setw(14) << "n/a" << setw(14) << "n/a";
+        cout
+             << setw(12) << setprecision(2) << micros[0] << micros[1] << "\n";
+    }
+    scratchArenaEnabled = true;
+
+    cout << "--------------------------------------------------------------\n";
+    cout << "Arena size on this thread: " << threadArena().capacity() / 1024 << " KB\n";
+    cout << "(The greedy route still allocates its returned Route and its cost evaluation.)\n";
+    if(heapAllocationCount() < 0)
+        cout << YELLOW << "Allocation counts need a build with -DCOUNT_HEAP_ALLOCATIONS.\n" << RESET;
+    if(sink == 42) cout << "";   // keeps the queries from being optimised away
+}
+
+void benchmarkZoneSort() {
+    int n;
+    cout << CYAN << "Number of synthetic zones (e.g. 200000): " << RESET;
+    cin >> n;
+    if(n < 2 || n > 5000000) {
+        cout << RED << "Zone count must be between 2 and 5000000.\n" << RESET;
+        return;
+    }
+
+    mt19937 rng(77);
+    vector<Zone> randomFill(n), sortedFill(n);
+    for(int i = 0; i < n; i++) {
+        randomFill[i] = Zone(i, "ZONE_" + to_string(i), rng() % 101);
+        randomFill[i].history.assign(7, randomFill[i].currentWaste);
+        sortedFill[i] = randomFill[i];
+        sortedFill[i].currentWaste = 100 - (int)(100LL * i / n);   // already in priority order
+    }
+
+    cout << BLUE << "=============== ZONE SORTING ===============\n" << RESET;
+    cout << "Zones: " << n << "   Pool threads: " << plannerPool().threads() << "\n";
+    cout << left << setw(26) << "ALGORITHM" << setw(16) << "RANDOM (ms)" << "PRE-SORTED (ms)\n";
+    cout << "--------------------------------------------------------------\n";
+
+    auto timeSort = [](vector<Zone> v, const function<void(vector<Zone>&)>& sorter, vector<Zone>* out) {
+        auto t0 = chrono::steady_clock::now();
+        sorter(v);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        if(out) *out = move(v);
+        return ms;
+    };
+
+    vector<pair<string, function<void(vector<Zone>&)>>> sorters = {
+        {"Introsort on keys", [](vector<Zone>& v) { SortingAlgorithms::quickSort(v, 0, v.size() - 1, true); }},
+        {"Merge sort on keys", [](vector<Zone>& v) { SortingAlgorithms::mergeSort(v, 0, v.size() - 1, true); }},
+        {"Counting sort on waste", [](vector<Zone>& v) { SortingAlgorithms::countingSort(v, 0, v.size() - 1); }},
+        {"STL stable_sort (Zones)", [](vector<Zone>& v) { stable_sort(v.begin(), v.end(), sortByWaste); }},
+    };
+
+    vector<Zone> reference, result;
+    timeSort(randomFill, sorters.back().second, &reference);
+    bool allMatch = true;
+    for(auto& s : sorters) {
+        double randomMs = timeSort(randomFill, s.second, &result);
+        double sortedMs = timeSort(sortedFill, s.second, nullptr);
+        for(int i = 0; i < n && allMatch; i++) allMatch = (result[i].id == reference[i].id);
+        cout << left << setw(26) << s.first << fixed << setprecision(2)
+             << setw(16) << randomMs << sortedMs << "\n";
+    }
+    cout << "--------------------------------------------------------------\n";
+    if(allMatch) cout << GREEN << "All algorithms produced the same (stable) order.\n" << RESET;
+    else cout << RED << "Order mismatch between algorithms!\n" << RESET;
+
+    // Live order: one radix build, then single-zone changes move into place
+    vector<int> keys(n), waste(n), yardKm(n);
+    for(int i = 0; i < n; i++) {
+        waste[i] = randomFill[i].currentWaste;
+        yardKm[i] = rng() % 50;
+        keys[i] = PriorityOrder::makeKey(waste[i], yardKm[i]);
+    }
+    PriorityOrder live;
+    auto t0 = chrono::steady_clock::now();
+    live.rebuild(keys);
+    double buildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+
+    int changes = 10000;
+    auto t1 = chrono::steady_clock::now();
+    for(int c = 0; c < changes; c++) {
+        int z = rng() % n;
+        waste[z] = min(100, waste[z] + 1);
+        keys[z] = PriorityOrder::makeKey(waste[z], yardKm[z]);
+        live.update(z, keys[z]);
+    }
+    double updateUs = chrono::duration<double, micro>(chrono::steady_clock::now() - t1).count() / changes;
+
+    // Collections and refills cross the whole order: the longest moves there are
+    auto t2 = chrono::steady_clock::now();
+    for(int c = 0; c < changes; c++) {
+        int z = rng() % n;
+        waste[z] = waste[z] >= 50 ? 0 : 100;
+        keys[z] = PriorityOrder::makeKey(waste[z], yardKm[z]);
+        live.update(z, keys[z]);
+    }
+    double collectUs = chrono::duration<double, micro>(chrono::steady_clock::now() - t2).count() / changes;
+
+    bool ordered = true;
+    const vector<int>& order = live.zonesInOrder();
+    for(int i = 1; i < n && ordered; i++)
+        ordered = keys[order[i - 1]] < keys[order[i]] || (keys[order[i - 1]] == keys[order[i]] && order[i - 1] < order[i]);
+
+    cout << "Live priority order: radix build " << fixed << setprecision(2) << buildMs
+         << " ms, then " << updateUs << " us per +1% fill change, "
+         << collectUs << " us per collection or refill (0% <-> 100%)\n";
+    if(!ordered) cout << RED << "Live order is out of order!\n" << RESET;
+}
+
+void benchmarkShortestPaths() {
+    int side, sources;
+    cout << CYAN << "Grid side for the road network (e.g. 300 -> 90000 junctions): " << RESET;
+    cin >> side;
+    cout << CYAN << "Source nodes per kernel (e.g. 20): " << RESET;
+    cin >> sources;
+    side = max(2, min(side, 2000));
+    sources = max(1, min(sources, 1000));
+    int n = side * side;
+
+    // City-like grid: blocks of 1-10 km plus a few long diagonal links
+    mt19937 rng(44);
+    vector<vector<Edge>> roads(n);
+    auto addRoad = [&](int a, int b, int w) {
+        roads[a].push_back({b, w});
+        roads[b].push_back({a, w});
+    };
+    for(int r = 0; r < side; r++)
+        for(int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if(c + 1 < side) addRoad(u, u + 1, 1 + rng() % 10);
+            if(r + 1 < side) addRoad(u, u + side, 1 + rng() % 10);
+        }
+    for(int k = 0; k < n / 20; k++) addRoad(rng() % n, rng() % n, 5 + rng() % 6);
+    int maxWeight = maxEdgeWeight(roads);
+
+    vector<int> from(sources);
+    for(int& s : from) s = rng() % n;
+
+    cout << BLUE << "=============== SHORTEST-PATH KERNELS ===============\n" << RESET;
+    cout << "Junctions: " << n << "   Max road length: " << maxWeight << " km   Auto pick: "
+         << pathKernelName(choosePathKernel(maxWeight)) << "\n";
+    cout << left << setw(20) << "KERNEL" << setw(16) << "MS / SEARCH" << "SPEEDUP\n";
+    cout << "--------------------------------------------------------------\n";
+
+    vector<int> distance(n), reference(n);
+    long long checksum[3] = {0, 0, 0};
+    double baseline = 0;
+    PathKernel kernels[3] = {PathKernel::BINARY_HEAP, PathKernel::DIAL_BUCKETS, PathKernel::RADIX_HEAP};
+    bool match = true;
+    for(int k = 0; k < 3; k++) {
+        auto t0 = chrono::steady_clock::now();
+        for(int s : from) {
+            shortestPaths(roads, s, maxWeight, kernels[k], distance.data());
+            for(int v = 0; v < n; v += 97) checksum[k] += distance[v];
+        }
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count() / sources;
+        if(k == 0) baseline = ms;
+
+        // Spot-check the last search against the binary heap
+        shortestPaths(roads, from.back(), maxWeight, PathKernel::BINARY_HEAP, reference.data());
+        if(distance != reference) match = false;
+
+        cout << left << setw(20) << pathKernelName(kernels[k]) << setw(16) << fixed << setprecision(3) << ms
+             << setprecision(2) << baseline / max(ms, 1e-9) << "x\n";
+    }
+    cout << "--------------------------------------------------------------\n";
+    if(match && checksum[0] == checksum[1] && checksum[0] == checksum[2])
+        cout << GREEN << "All kernels returned identical distances.\n" << RESET;
+    else
+        cout << RED << "Distance mismatch between kernels!\n" << RESET;
+}
+
+void benchmarkSpreadBfs() {
+    int side, originCount;
+    cout << CYAN << "Grid side for the road network (e.g. 1000 -> 1M junctions): " << RESET;
+    cin >> side;
+    cout << CYAN << "Number of outbreak origins (e.g. 8): " << RESET;
+    cin >> originCount;
+    side = max(2, min(side, 3000));
+    originCount = max(1, min(originCount, 1000));
+    int n = side * side;
+
+    mt19937 rng(45);
+    vector<vector<Edge>> roads(n);
+    auto addRoad = [&](int a, int b) {
+        roads[a].push_back({b, 1});
+        roads[b].push_back({a, 1});
+    };
+    for(int r = 0; r < side; r++)
+        for(int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if(c + 1 < side) addRoad(u, u + 1);
+            if(r + 1 < side) addRoad(u, u + side);
+        }
+    for(int k = 0; k < n / 10; k++) addRoad(rng() % n, rng() % n);   // shortcuts: low diameter
+
+    vector<int> origins(originCount);
+    for(int& o : origins) o = rng() % n;
+
+    // Baseline: one queue BFS per origin, keeping the nearest level
+    auto t0 = chrono::steady_clock::now();
+    vector<int> best(n, INT_MAX), level(n);
+    for(int o : origins) {
+        fill(level.begin(), level.end(), -1);
+        queue<int> q;
+        q.push(o);
+        level[o] = 0;
+        while(!q.empty()) {
+            int u = q.front(); q.pop();
+            for(auto& e : roads[u])
+                if(level[e.to] == -1) {
+                    level[e.to] = level[u] + 1;
+                    q.push(e.to);
+                }
+        }
+        for(int v = 0; v < n; v++) if(level[v] != -1) best[v] = min(best[v], level[v]);
+    }
+    for(int& b : best) if(b == INT_MAX) b = -1;
+    double queueMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+
+    auto t1 = chrono::steady_clock::now();
+    vector<int> multi(n);
+    BfsStats stats = multiSourceBfs(roads, origins, multi.data(), plannerPool());
+    double frontierMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t1).count();
+
+    cout << BLUE << "=============== MULTI-ORIGIN SPREAD (BFS) ===============\n" << RESET;
+    cout << "Junctions: " << n << "   Origins: " << originCount << "   Pool threads: " << plannerPool().threads() << "\n";
+    cout << "--------------------------------------------------------------\n";
+    cout << left << setw(34) << "Queue BFS per origin" << fixed << setprecision(1) << queueMs << " ms\n";
+    cout << left << setw(34) << "Direction-optimizing, one pass" << frontierMs << " ms ("
+         << stats.topDownSteps << " top-down / " << stats.bottomUpSteps << " bottom-up levels)\n";
+    cout << "--------------------------------------------------------------\n";
+    cout << "Speedup: " << setprecision(2) << queueMs / max(frontierMs, 0.001) << "x\n";
+    if(multi == best) cout << GREEN << "Both produced the same level array.\n" << RESET;
+    else cout << RED << "Level mismatch!\n" << RESET;
+}
+
+void benchmarkForecaster() {
+    int n;
+    cout << CYAN << "Number of synthetic zones (e.g. 100000): " << RESET;
+    cin >> n;
+    if(n < 1 || n > 10000000) {
+        cout << RED << "Zone count must be between 1 and 10000000.\n" << RESET;
+        return;
+    }
+
+    // Four weeks of daily readings per zone: steady growth, one busy weekday, collections
+    // near full, sensor noise. Day 29 is held out to score the forecasts.
+    static constexpr int DAYS = 28;
+    mt19937 rng(47);
+    vector<Zone> synthetic(n);
+    vector<int> actual(n), current(n);
+    for(int z = 0; z < n; z++) {
+        int growth = 3 + rng() % 8;
+        int busyDay = rng() % 7;
+        int fill = rng() % 40;
+        vector<int>& h = synthetic[z].history;
+        for(int d = 0; d <= DAYS; d++) {
+            fill += growth + (d % 7 == busyDay ? 12 : 0) + (int)(rng() % 5) - 2;
+            if(fill >= 90) fill = rng() % 10;      // collected
+            fill = max(0, min(100, fill));
+            if(d < DAYS) h.push_back(fill);
+            else actual[z] = fill;
+        }
+        synthetic[z].currentWaste = current[z] = h.back();
+    }
+
+    WasteForecaster model;
+    auto t0 = chrono::steady_clock::now();
+    model.fit(synthetic, plannerPool());
+    double fitMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+
+    static constexpr int REPS = 50;
+    vector<int> predicted(n);
+    auto t1 = chrono::steady_clock::now();
+    for(int r = 0; r < REPS; r++) model.forecastAll(1 + r % 7, current.data(), predicted.data());
+    double batchMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t1).count() / REPS;
+
+    model.forecastAll(1, current.data(), predicted.data());
+    long long modelError = 0, lastValueError = 0, lastDeltaError = 0;
+    for(int z = 0; z < n; z++) {
+        const vector<int>& h = synthetic[z].history;
+        int lastDelta = min(100, max(0, 2 * h[DAYS - 1] - h[DAYS - 2]));
+        modelError += abs(predicted[z] - actual[z]);
+        lastValueError += abs(current[z] - actual[z]);
+        lastDeltaError += abs(lastDelta - actual[z]);
+    }
+
+    auto t2 = chrono::steady_clock::now();
+    int tomorrow = WasteForecaster::today() + 1;
+    for(int z = 0; z < n; z++) model.observe(z, actual[z], tomorrow);
+    double observeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t2).count();
+
+    cout << BLUE << "=============== WASTE FORECASTING (HOLT-WINTERS) ===============\n" << RESET;
+    cout << "Zones: " << n << "   History: " << DAYS << " days   Pool threads: " << plannerPool().threads() << "\n";
+    cout << "--------------------------------------------------------------\n";
+    cout << left << setw(34) << "Fit from history (one pass)" << fixed << setprecision(3) << fitMs << " ms\n";
+    cout << left << setw(34) << "Forecast all zones (batch)" << batchMs << " ms\n";
+    cout << left << setw(34) << "Incremental update, all zones" << observeMs << " ms ("
+         << setprecision(1) << observeMs * 1e6 / n << " ns per reading)\n";
+    cout << "--------------------------------------------------------------\n";
+    cout << "Mean absolute error, next day:\n";
+    cout << left << setw(34) << "  Holt-Winters" << setprecision(2) << (double)modelError / n << "%\n";
+    cout << left << setw(34) << "  Today's value" << (double)lastValueError / n << "%\n";
+    cout << left << setw(34) << "  Today + last change" << (double)lastDeltaError / n << "%\n";
+}
+
+void benchmarkTerritories() {
+    int side, k;
+    cout << CYAN << "Grid side for the road network (e.g. 320 -> 100k zones): " << RESET;
+    cin >> side;
+    cout << CYAN << "Number of districts (e.g. 16): " << RESET;
+    cin >> k;
+    side = max(2, min(side, 2000));
+    int n = side * side;
+    k = max(1, min(k, n));
+
+    // Road grid with uneven block lengths; waste is heavier towards one corner
+    mt19937 rng(50);
+    vector<vector<Edge>> roads(n);
+    auto addRoad = [&](int a, int b) {
+        int w = 1 + rng() % 9;
+        roads[a].push_back({b, w});
+        roads[b].push_back({a, w});
+    };
+    vector<int> weight(n);
+    for(int r = 0; r < side; r++)
+        for(int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if(c + 1 < side) addRoad(u, u + 1);
+            if(r + 1 < side) addRoad(u, u + side);
+            weight[u] = 1 + rng() % 50 + 50 * (r + c) / (2 * side);
+        }
+
+    TerritoryPartitioner territories;
+    auto t0 = chrono::steady_clock::now();
+    territories.partition(roads, weight, k, 0);
+    double partitionMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+
+    // Baseline: every zone to its nearest medoid (plain graph Voronoi), same centres
+    vector<int> centres(territories.count());
+    for(int d = 0; d < (int)centres.size(); d++) centres[d] = territories.medoid(d);
+    NearestFacilityIndex voronoi;
+    auto t1 = chrono::steady_clock::now();
+    voronoi.build(roads, centres);
+    double voronoiMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t1).count();
+
+    vector<int> slot(n, -1);
+    for(int d = 0; d < (int)centres.size(); d++) slot[centres[d]] = d;
+    vector<long long> voronoiWaste(centres.size(), 0);
+    for(int z = 0; z < n; z++) voronoiWaste[slot[voronoi.facility(z)]] += weight[z];
+
+    long long total = accumulate(weight.begin(), weight.end(), 0LL);
+    int heaviest = 0;
+    for(int d = 0; d < territories.count(); d++) heaviest = max(heaviest, territories.waste(d));
+    double mean = (double)total / territories.count();
+
+    cout << BLUE << "=============== TERRITORY PARTITIONING ===============\n" << RESET;
+    cout << "Zones: " << n << "   Districts: " << territories.count() << "   Rounds: " << territories.rounds() << "\n";
+    cout << "--------------------------------------------------------------\n";
+    cout << left << setw(34) << "Balanced bubble growth" << fixed << setprecision(1) << partitionMs << " ms\n";
+    cout << left << setw(34) << "Nearest-medoid Voronoi" << voronoiMs << " ms\n";
+    cout << "--------------------------------------------------------------\n";
+    cout << "Heaviest district, waste over the mean:\n";
+    cout << left << setw(34) << "  Balanced" << setprecision(2) << heaviest / mean << "x\n";
+    cout << left << setw(34) << "  Voronoi" << *max_element(voronoiWaste.begin(), voronoiWaste.end()) / mean << "x\n";
+    cout << left << setw(34) << "Load incl. road km (balanced)" << territories.imbalance() << "x\n";
+    if(territories.fragments(roads) == territories.count()) cout << GREEN << "Every district is contiguous.\n" << RESET;
+    else cout << RED << "Some district is split!\n" << RESET;
+}
+
+void performanceBenchmarks() {
+    cout << BLUE << "=============== PERFORMANCE BENCHMARKS ===============\n" << RESET;
+    cout << "1. Nearest-Unvisited Route Build (SIMD vs scalar)\n";
+    cout << "2. Sensor Feed Ingestion Throughput\n";
+    cout << "3. Snapshot Readers During Live Ingestion\n";
+    cout << "4. Work-Stealing Scheduler Scaling (APSP / reduce)\n";
+    cout << "5. Scratch Arena: Heap Allocations per Query\n";
+    cout << "6. Zone Sorting (key/index sorts vs STL)\n";
+    cout << "7. Shortest-Path Kernels (Dial / radix heap / binary heap)\n";
+    cout << "8. Multi-Origin Spread (direction-optimizing BFS)\n";
+    cout << "9. Waste Forecasting (batch Holt-Winters)\n";
+    cout << "10. Territory Partitioning (balanced districts)\n";
+    cout << "Enter choice: ";
+    int choice;
+    cin >> choice;
+
+    switch(choice) {
+        case 1: benchmarkRouteBuild(); break;
+        case 2: benchmarkSensorIngest(); break;
+        case 3: benchmarkSnapshotReaders(); break;
+        case 4: benchmarkScheduler(); break;
+        case 5: benchmarkScratchArena(); break;
+        case 6: benchmarkZoneSort(); break;
+        case 7: benchmarkShortestPaths(); break;
+        case 8: benchmarkSpreadBfs(); break;
+        case 9: benchmarkForecaster(); break;
+        case 10: benchmarkTerritories(); break;
+        default:
+            cout << RED << "Invalid choice.\n" << RESET;
+    }
+}
+
 /**********************************************************************************************
 LOGIN FUNCTIONS
 **********************************************************************************************/
@@ -2427,6 +8883,7 @@ void adminLogin(){
     cin>>p;
     if(u=="admin"&&p=="admin@123"){
         currentRole="admin";
+        currentUser=u;
         loggedIn=true;
         cout << GREEN << "Login successful!\n" << RESET;
     } else {
@@ -2460,6 +8917,7 @@ bool loginUser(string role){
     while(fp>>fu>>fpw){
         if(u==fu&&p==fpw){
             currentRole=role;
+            currentUser=u;
             loggedIn=true;
             fp.close();
             cout << GREEN << "Login successful!\n" << RESET;
@@ -2519,6 +8977,7 @@ void menu(){
         cin >> choice;
 
         system("cls");
+        pollSensorFeed();
 
         switch(choice){
             case 1: showZones(); break;
@@ -2550,6 +9009,7 @@ void menu(){
             case 23: exportGraphData(); break;
             case 0: return;
         }
+        publishZoneState();
         
         if(choice != 0){
             cout << "\nPress ENTER to continue...";
@@ -2563,9 +9023,34 @@ void menu(){
 /**********************************************************************************************
 MAIN FUNCTION
 **********************************************************************************************/
-int main()
+// driverdisplay --headless [--feed <readings file or pipe>] [--hours N] [--interval S] [--once]
+int main(int argc, char* argv[])
 {
+    bool headless = false, once = false;
+    string feedPath;
+    int alertHours = 12, intervalSeconds = 5;
+    for(int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if(arg == "--headless") headless = true;
+        else if(arg == "--once") once = true;
+        else if(arg == "--feed" && i + 1 < argc) feedPath = argv[++i];
+        else if(arg == "--hours" && i + 1 < argc) alertHours = min(24 * 366, max(0, atoi(argv[++i])));
+        else if(arg == "--interval" && i + 1 < argc) intervalSeconds = max(1, atoi(argv[++i]));
+        else {
+            cerr << "Unknown option " << arg << "\n";
+            return 1;
+        }
+    }
+
     WasteRoutePlanner app;
+
+    if(headless) {
+        signal(SIGINT, [](int) { WasteRoutePlanner::alertFeedStop = 1; });
+        signal(SIGTERM, [](int) { WasteRoutePlanner::alertFeedStop = 1; });
+        app.runAlertFeed(feedPath, alertHours, intervalSeconds, once);
+        return 0;
+    }
+
     app.loginPage();
     
     if(loggedIn == true && currentRole == "admin")
@@ -2599,6 +9084,9 @@ int main()
             cout << "22. Simulate Waste Generation\n";
             cout << "23. Export Graph Data\n";
             cout << "24. Display All Drivers\n";
+            cout << "25. Performance Benchmarks\n";
+            cout << "26. Live Sensor Feed\n";
+            cout << "27. What-If Scenarios\n";
 
             cout << " 0. Exit Program\n";
             cout << "==============================================================\n";
@@ -2606,6 +9094,7 @@ int main()
             cin >> choice;
 
             system("cls");
+            app.pollSensorFeed();      // safe point: apply live readings before the action runs
 
             switch(choice){
                 case 1: app.showZones(); break;
@@ -2636,10 +9125,15 @@ int main()
                 case 22: app.simulateWasteGeneration(); break;
                 case 23: app.exportGraphData(); break;
                 case 24: app.displayAllDrivers(); break;
+                case 25: app.performanceBenchmarks(); break;
+                case 26: app.sensorFeedMenu(); break;
+                case 27: app.whatIfScenarios(); break;
 
                 case 0: return 0;
             }
             
+            app.publishZoneState();    // readers on other threads see the action's changes
+
             if(choice != 0){
                 cout << "\nPress ENTER to continue...";
                 cin.ignore();
@@ -2664,6 +9158,7 @@ int main()
             cin >> choice1;
 
             system("cls");
+            app.pollSensorFeed();      // safe point: apply live readings before the action runs
 
             switch(choice1){
                 case 1: app.showZones(); break;
@@ -2673,6 +9168,8 @@ int main()
                 case 0: return 0;
             }
             
+            app.publishZoneState();    // readers on other threads see the action's changes
+
             if(choice1 != 0){
                 cout << "\nPress ENTER to continue...";
                 cin.ignore();
@@ -2700,6 +9197,7 @@ int main()
             cin >> choice2;
 
             system("cls");
+            app.pollSensorFeed();      // safe point: apply live readings before the action runs
 
             switch(choice2){
                 case 7: app.driversRoute(); break;
@@ -2717,6 +9215,8 @@ int main()
                 case 0: return 0;
             }
             
+            app.publishZoneState();    // readers on other threads see the action's changes
+
             if(choice2 != 0){
                 cout << "\nPress ENTER to continue...";
                 cin.ignore();